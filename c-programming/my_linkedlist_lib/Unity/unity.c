@@ -4,9 +4,22 @@
     [Released under MIT License. Please refer to license.txt for details]
 ========================================== */
 
+#if (!defined(UNITY_EXCLUDE_TIMING) || !defined(UNITY_EXCLUDE_PARALLEL)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include "unity.h"
 #include <stdio.h>
 #include <string.h>
+#ifndef UNITY_EXCLUDE_TIMING
+#include <time.h>
+#endif
+#ifndef UNITY_EXCLUDE_PARALLEL
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #define UNITY_FAIL_AND_BAIL   { Unity.CurrentTestFailed  = 1; UNITY_OUTPUT_CHAR('\n'); longjmp(Unity.AbortFrame, 1); }
 #define UNITY_IGNORE_AND_BAIL { Unity.CurrentTestIgnored = 1; UNITY_OUTPUT_CHAR('\n'); longjmp(Unity.AbortFrame, 1); }
@@ -203,6 +216,40 @@ void UnityPrintFloat(_UF number)
 }
 #endif
 
+//-----------------------------------------------
+/// prints a duration in ns, us or ms, moving to the larger unit from 10000 of the smaller one
+void UnityPrintDuration(const UNITY_TIME_TYPE ns)
+{
+    char digits[24];
+    int count = 0;
+    UNITY_TIME_TYPE value = ns;
+    const char* unit = " ns";
+
+    if (value >= 10000000ULL)
+    {
+        value /= 1000000ULL;
+        unit = " ms";
+    }
+    else if (value >= 10000ULL)
+    {
+        value /= 1000ULL;
+        unit = " us";
+    }
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value > 0);
+
+    while (count > 0)
+    {
+        UNITY_OUTPUT_CHAR(digits[--count]);
+    }
+
+    UnityPrint(unit);
+}
+
 //-----------------------------------------------
 void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
 {
@@ -232,6 +279,18 @@ void UnityConcludeTest(void)
     {
         UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
         UnityPrint("PASS");
+#ifndef UNITY_EXCLUDE_TIMING
+        UnityPrint(" (");
+        UnityPrintDuration(UnityNowNs() - Unity.CurrentTestStartNs);
+        if (Unity.CurrentBenchmarkRepeats > 0)
+        {
+            UnityPrint(", best of ");
+            UnityPrintNumberUnsigned(Unity.CurrentBenchmarkRepeats);
+            UnityPrint(": ");
+            UnityPrintDuration(Unity.CurrentBenchmarkNs);
+        }
+        UNITY_OUTPUT_CHAR(')');
+#endif
         UNITY_PRINT_EOL;
     }
     else
@@ -241,6 +300,8 @@ void UnityConcludeTest(void)
 
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
+    Unity.CurrentBenchmarkNs = 0;
+    Unity.CurrentBenchmarkRepeats = 0;
 }
 
 //-----------------------------------------------
@@ -790,14 +851,53 @@ void UnityIgnore(const char* msg, const UNITY_LINE_TYPE line)
     UNITY_IGNORE_AND_BAIL;
 }
 
+//-----------------------------------------------
+void UnityAssertDurationBelow(const UNITY_TIME_TYPE limit,
+                              const UNITY_TIME_TYPE actual,
+                              const char* msg,
+                              const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_SKIP_EXECUTION;
+
+    if (actual >= limit * (UNITY_TIME_TYPE)UNITY_DURATION_SCALE)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(" Expected Duration Below ");
+        UnityPrintDuration(limit * (UNITY_TIME_TYPE)UNITY_DURATION_SCALE);
+        UnityPrint(UnityStrWas);
+        UnityPrintDuration(actual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+}
+
+//-----------------------------------------------
+void UnityRecordBenchmark(const UNITY_TIME_TYPE best, const _UU32 repeats)
+{
+    Unity.CurrentBenchmarkNs = best;
+    Unity.CurrentBenchmarkRepeats = repeats;
+}
+
+//-----------------------------------------------
+UNITY_TIME_TYPE UnityNowNs(void)
+{
+#ifndef UNITY_EXCLUDE_TIMING
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (UNITY_TIME_TYPE)now.tv_sec * 1000000000ULL + (UNITY_TIME_TYPE)now.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
 //-----------------------------------------------
 void setUp(void);
 void tearDown(void);
-void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+static void UnityRunTestInProcess(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
 {
     Unity.CurrentTestName = FuncName;
     Unity.CurrentTestLineNumber = FuncLineNum;
-    Unity.NumberOfTests++; 
+    Unity.CurrentTestStartNs = UnityNowNs();
     if (TEST_PROTECT())
     {
         setUp();
@@ -810,15 +910,268 @@ void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int
     UnityConcludeTest();
 }
 
+#ifndef UNITY_EXCLUDE_PARALLEL
+//-----------------------------------------------
+// Parallel Test Runner
+//-----------------------------------------------
+
+// Exit codes of a test process. Any other exit, or a signal, is reported as a failure.
+#define UNITY_PARALLEL_EXIT_PASS   0
+#define UNITY_PARALLEL_EXIT_FAIL   101
+#define UNITY_PARALLEL_EXIT_IGNORE 102
+
+typedef struct
+{
+    UnityTestFunction Func;
+    const char* FuncName;
+    int FuncLineNum;
+    int Serial;
+    pid_t Pid;
+    FILE* Output;
+    UNITY_TIME_TYPE StartNs;
+} UnityParallelTest;
+
+static UnityParallelTest UnityParallelQueue[UNITY_PARALLEL_MAX_TESTS];
+static _UU32 UnityParallelQueued;
+
+//-----------------------------------------------
+static void UnityParallelCopyOutput(FILE* output)
+{
+    int c;
+
+    rewind(output);
+    while ((c = getc(output)) != EOF)
+    {
+        UNITY_OUTPUT_CHAR(c);
+    }
+    fclose(output);
+}
+
+//-----------------------------------------------
+static void UnityParallelRunChild(UnityParallelTest* test)
+{
+    dup2(fileno(test->Output), STDOUT_FILENO);
+    dup2(fileno(test->Output), STDERR_FILENO);
+    setvbuf(stdout, NULL, _IONBF, 0); // keep what a crashing test printed
+    Unity.TestFailures = 0;
+    Unity.TestIgnores = 0;
+
+    UnityRunTestInProcess(test->Func, test->FuncName, test->FuncLineNum);
+
+    // exit() rather than _exit(), so that exit handlers such as LeakSanitizer's check every test
+    if (Unity.TestFailures != 0U)
+    {
+        exit(UNITY_PARALLEL_EXIT_FAIL);
+    }
+    exit(Unity.TestIgnores != 0U ? UNITY_PARALLEL_EXIT_IGNORE : UNITY_PARALLEL_EXIT_PASS);
+}
+
+//-----------------------------------------------
+// Forks a process for the test, with its output going to a temporary file.
+// Returns 0 if the test is running; if it cannot be forked it has already run in this process.
+static int UnityParallelStart(UnityParallelTest* test)
+{
+    test->Output = tmpfile();
+    fflush(stdout);
+    fflush(stderr);
+    test->StartNs = UnityNowNs();
+    test->Pid = (test->Output != NULL) ? fork() : -1;
+
+    if (test->Pid == 0)
+    {
+        UnityParallelRunChild(test);
+    }
+    if (test->Pid > 0)
+    {
+        return 0;
+    }
+
+    if (test->Output != NULL)
+    {
+        fclose(test->Output);
+    }
+    test->Pid = 0;
+    UnityRunTestInProcess(test->Func, test->FuncName, test->FuncLineNum);
+    return -1;
+}
+
+//-----------------------------------------------
+// Copies the output of a finished test and counts its result from the exit status.
+static void UnityParallelFinish(UnityParallelTest* test, int status)
+{
+    Unity.ParallelTestNs += UnityNowNs() - test->StartNs;
+    UnityParallelCopyOutput(test->Output);
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) == UNITY_PARALLEL_EXIT_PASS)
+    {
+        return;
+    }
+    if (WIFEXITED(status) && WEXITSTATUS(status) == UNITY_PARALLEL_EXIT_FAIL)
+    {
+        Unity.TestFailures++;
+        return;
+    }
+    if (WIFEXITED(status) && WEXITSTATUS(status) == UNITY_PARALLEL_EXIT_IGNORE)
+    {
+        Unity.TestIgnores++;
+        return;
+    }
+
+    Unity.CurrentTestName = test->FuncName;
+    UnityTestResultsFailBegin((UNITY_LINE_TYPE)test->FuncLineNum);
+    if (WIFSIGNALED(status))
+    {
+        UnityPrint(" Crashed With Signal ");
+        UnityPrintNumber(WTERMSIG(status));
+    }
+    else
+    {
+        UnityPrint(" Exited With Status ");
+        UnityPrintNumber(WEXITSTATUS(status));
+    }
+    UNITY_PRINT_EOL;
+    Unity.TestFailures++;
+}
+
+//-----------------------------------------------
+// Runs the queued tests of one kind, at most workers at a time, and prints their output in the order they finish.
+static void UnityParallelRunTests(const int serial, const _UU32 workers)
+{
+    _UU32 next = 0;
+    _UU32 running = 0;
+
+    while (next < UnityParallelQueued || running > 0U)
+    {
+        int status;
+        pid_t pid;
+        _UU32 index;
+
+        while (running < workers && next < UnityParallelQueued)
+        {
+            UnityParallelTest* test = &UnityParallelQueue[next++];
+
+            if (test->Serial == serial && UnityParallelStart(test) == 0)
+            {
+                running++;
+            }
+        }
+        if (running == 0U)
+        {
+            continue;
+        }
+
+        pid = waitpid(-1, &status, 0);
+        for (index = 0; index < next; index++)
+        {
+            if (pid > 0 && UnityParallelQueue[index].Pid == pid)
+            {
+                UnityParallelQueue[index].Pid = 0;
+                UnityParallelFinish(&UnityParallelQueue[index], status);
+                running--;
+                break;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------
+// Runs the forked batch first, then the serial tests one at a time, so that timed tests do not share the CPUs.
+static void UnityParallelRun(void)
+{
+    UnityParallelRunTests(0, Unity.ParallelWorkers);
+    UnityParallelRunTests(1, 1);
+    UnityParallelQueued = 0;
+}
+
+//-----------------------------------------------
+static void UnityParallelEnqueue(UnityTestFunction Func, const char* FuncName, const int FuncLineNum, const int Serial)
+{
+    UnityParallelTest* test;
+
+    if (UnityParallelQueued == UNITY_PARALLEL_MAX_TESTS)
+    {
+        UnityParallelRun();
+    }
+
+    test = &UnityParallelQueue[UnityParallelQueued++];
+    test->Func = Func;
+    test->FuncName = FuncName;
+    test->FuncLineNum = FuncLineNum;
+    test->Serial = Serial;
+    test->Pid = 0;
+    test->Output = NULL;
+}
+#endif
+
+//-----------------------------------------------
+void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+{
+    Unity.NumberOfTests++;
+#ifndef UNITY_EXCLUDE_PARALLEL
+    if (Unity.ParallelWorkers > 0U)
+    {
+        UnityParallelEnqueue(Func, FuncName, FuncLineNum, 0);
+        return;
+    }
+#endif
+    UnityRunTestInProcess(Func, FuncName, FuncLineNum);
+}
+
+//-----------------------------------------------
+void UnitySerialTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+{
+    Unity.NumberOfTests++;
+#ifndef UNITY_EXCLUDE_PARALLEL
+    if (Unity.ParallelWorkers > 0U)
+    {
+        UnityParallelEnqueue(Func, FuncName, FuncLineNum, 1);
+        return;
+    }
+#endif
+    UnityRunTestInProcess(Func, FuncName, FuncLineNum);
+}
+
 //-----------------------------------------------
 void UnityBegin(void)
 {
     Unity.NumberOfTests = 0;
+    Unity.ParallelWorkers = 0;
+}
+
+//-----------------------------------------------
+void UnityBeginParallel(const _UU32 workers)
+{
+    UnityBegin();
+#ifndef UNITY_EXCLUDE_PARALLEL
+    {
+        const char* setting = getenv("UNITY_WORKERS");
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+        if (setting != NULL)
+        {
+            Unity.ParallelWorkers = (_UU32)strtoul(setting, NULL, 10);
+        }
+        else
+        {
+            Unity.ParallelWorkers = (workers > 0U) ? workers : (online > 0 ? (_UU32)online : 1U);
+        }
+        Unity.ParallelStartNs = UnityNowNs();
+        Unity.ParallelTestNs = 0;
+    }
+#else
+    (void)workers;
+#endif
 }
 
 //-----------------------------------------------
 int UnityEnd(void)
 {
+#ifndef UNITY_EXCLUDE_PARALLEL
+    if (Unity.ParallelWorkers > 0U)
+    {
+        UnityParallelRun();
+    }
+#endif
     UnityPrint("-----------------------");
     UNITY_PRINT_EOL;
     UnityPrintNumber(Unity.NumberOfTests);
@@ -828,6 +1181,21 @@ int UnityEnd(void)
     UnityPrintNumber(Unity.TestIgnores);
     UnityPrint(" Ignored");
     UNITY_PRINT_EOL;
+#ifndef UNITY_EXCLUDE_PARALLEL
+    if (Unity.ParallelWorkers > 0U)
+    {
+        UnityPrintNumberUnsigned(Unity.ParallelWorkers);
+        UnityPrint(" Workers");
+#ifndef UNITY_EXCLUDE_TIMING
+        UnityPrint(", ");
+        UnityPrintDuration(UnityNowNs() - Unity.ParallelStartNs);
+        UnityPrint(" Elapsed, ");
+        UnityPrintDuration(Unity.ParallelTestNs);
+        UnityPrint(" In Tests");
+#endif
+        UNITY_PRINT_EOL;
+    }
+#endif
     if (Unity.TestFailures == 0U)
     {
         UnityPrint("OK");
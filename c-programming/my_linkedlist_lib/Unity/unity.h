@@ -28,6 +28,18 @@
 // Output
 //     - by default, Unity prints to standard out with putchar.  define UNITY_OUTPUT_CHAR(a) with a different function if desired
 
+// Timing
+//     - every test is timed with clock_gettime(CLOCK_MONOTONIC) and the time is printed on its PASS line.  define UNITY_EXCLUDE_TIMING where that clock does not exist; the performance asserts then run their statements once without checking them
+//     - define UNITY_DURATION_SCALE to multiply every duration limit, e.g. for sanitizer or valgrind builds
+//     - define UNITY_TIME_TYPE with a different type if unsigned long long nanoseconds do not suit you
+
+// Parallel Running
+//     - call UnityBeginParallel(workers) instead of UnityBegin() to queue every RUN_TEST and run the queue from UnityEnd() in forked processes, at most workers at a time (0 for one per online processor).  a test that crashes is reported as a failure and the suite goes on; output is printed per test in the order the tests finish
+//     - the UNITY_WORKERS environment variable overrides the number of workers; UNITY_WORKERS=0 runs the tests one by one in the calling process, e.g. under a debugger
+//     - RUN_TEST_SERIAL queues a test that must not share the CPUs, e.g. one with performance asserts.  serial tests run after the forked batch, one at a time, each still in its own process
+//     - define UNITY_PARALLEL_MAX_TESTS to change how many tests are queued before the queue is run (default 1024)
+//     - define UNITY_EXCLUDE_PARALLEL where fork() does not exist; UnityBeginParallel() then behaves like UnityBegin()
+
 // Optimization
 //     - by default, line numbers are stored in unsigned shorts.  Define UNITY_LINE_TYPE with a different type if your files are huge
 //     - by default, test and failure counters are unsigned shorts.  Define UNITY_COUNTER_TYPE with a different type if you want to save space or have more than 65535 Tests.
@@ -44,6 +56,10 @@
 #define RUN_TEST(func, line_num) UnityDefaultTestRun(func, #func, line_num)
 #endif
 
+#ifndef RUN_TEST_SERIAL
+#define RUN_TEST_SERIAL(func, line_num) UnitySerialTestRun(func, #func, line_num)
+#endif
+
 #define TEST_LINE_NUM (Unity.CurrentTestLineNumber)
 #define TEST_IS_IGNORED (Unity.CurrentTestIgnored)
 
@@ -59,6 +75,17 @@
 #define TEST_IGNORE()                                                                              UNITY_TEST_IGNORE(__LINE__, NULL)
 #define TEST_ONLY()
 
+//-------------------------------------------------------
+// Performance Asserts
+//-------------------------------------------------------
+
+// Runs the statements once and fails if they take limit nanoseconds or longer
+#define TEST_ASSERT_DURATION_BELOW_NS(limit, ...)                                                  UNITY_TEST_ASSERT_DURATION_BELOW_NS((limit), __LINE__, NULL, __VA_ARGS__)
+#define TEST_ASSERT_DURATION_BELOW_NS_MESSAGE(limit, message, ...)                                 UNITY_TEST_ASSERT_DURATION_BELOW_NS((limit), __LINE__, message, __VA_ARGS__)
+// Runs the statements repeats times and fails if even the fastest run takes limit nanoseconds or longer; the fastest run is printed on the PASS line
+#define TEST_BENCHMARK_BELOW_NS(repeats, limit, ...)                                               UNITY_TEST_BENCHMARK_BELOW_NS((repeats), (limit), __LINE__, NULL, __VA_ARGS__)
+#define TEST_BENCHMARK_BELOW_NS_MESSAGE(repeats, limit, message, ...)                              UNITY_TEST_BENCHMARK_BELOW_NS((repeats), (limit), __LINE__, message, __VA_ARGS__)
+
 //-------------------------------------------------------
 // Test Asserts (simple)
 //-------------------------------------------------------
@@ -136,6 +136,26 @@ extern int UNITY_OUTPUT_CHAR(int);
 #define UNITY_COUNTER_TYPE unsigned short
 #endif
 
+//-------------------------------------------------------
+// Timing
+//-------------------------------------------------------
+
+#ifndef UNITY_TIME_TYPE
+#define UNITY_TIME_TYPE unsigned long long
+#endif
+
+#ifndef UNITY_DURATION_SCALE
+#define UNITY_DURATION_SCALE (1)
+#endif
+
+//-------------------------------------------------------
+// Parallel Running
+//-------------------------------------------------------
+
+#ifndef UNITY_PARALLEL_MAX_TESTS
+#define UNITY_PARALLEL_MAX_TESTS (1024)
+#endif
+
 //-------------------------------------------------------
 // Internal Structs Needed
 //-------------------------------------------------------
@@ -181,6 +201,12 @@ struct _Unity
     UNITY_COUNTER_TYPE TestIgnores;
     UNITY_COUNTER_TYPE CurrentTestFailed;
     UNITY_COUNTER_TYPE CurrentTestIgnored;
+    UNITY_TIME_TYPE CurrentTestStartNs;
+    UNITY_TIME_TYPE CurrentBenchmarkNs;
+    _UU32 CurrentBenchmarkRepeats;
+    _UU32 ParallelWorkers;
+    UNITY_TIME_TYPE ParallelStartNs;
+    UNITY_TIME_TYPE ParallelTestNs;
     jmp_buf AbortFrame;
 };
 
@@ -191,9 +217,12 @@ extern struct _Unity Unity;
 //-------------------------------------------------------
 
 void UnityBegin(void);
+void UnityBeginParallel(const _UU32 workers);
 int  UnityEnd(void);
 void UnityConcludeTest(void);
 void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum);
+void UnitySerialTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum);
+UNITY_TIME_TYPE UnityNowNs(void);
 
 //-------------------------------------------------------
 // Test Output
@@ -205,6 +234,7 @@ void UnityPrintNumberByStyle(const _U_SINT number, const UNITY_DISPLAY_STYLE_T s
 void UnityPrintNumber(const _U_SINT number);
 void UnityPrintNumberUnsigned(const _U_UINT number);
 void UnityPrintNumberHex(const _U_UINT number, const char nibbles);
+void UnityPrintDuration(const UNITY_TIME_TYPE ns);
 
 #ifdef UNITY_FLOAT_VERBOSE
 void UnityPrintFloat(const _UF number);
@@ -237,6 +267,13 @@ void UnityAssertBits(const _U_SINT mask,
                      const char* msg,
                      const UNITY_LINE_TYPE lineNumber);
 
+void UnityAssertDurationBelow(const UNITY_TIME_TYPE limit,
+                              const UNITY_TIME_TYPE actual,
+                              const char* msg,
+                              const UNITY_LINE_TYPE lineNumber);
+
+void UnityRecordBenchmark(const UNITY_TIME_TYPE best, const _UU32 repeats);
+
 void UnityAssertEqualString(const char* expected,
                             const char* actual,
                             const char* msg,
@@ -342,6 +379,31 @@ void UnityAssertEqualFloatArray(const _UF* expected,
 #define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY(expected, actual, num_elements, line, message)       UnityAssertEqualIntArray((const _U_SINT*)(expected), (const _U_SINT*)(actual), (_UU32)(num_elements), (message), (UNITY_LINE_TYPE)line, UNITY_DISPLAY_STYLE_HEX64)
 #endif
 
+#ifdef UNITY_EXCLUDE_TIMING
+#define UNITY_TEST_ASSERT_DURATION_BELOW_NS(limit, line, message, ...)                           { __VA_ARGS__; }
+#define UNITY_TEST_BENCHMARK_BELOW_NS(repeats, limit, line, message, ...)                        { __VA_ARGS__; }
+#else
+#define UNITY_TEST_ASSERT_DURATION_BELOW_NS(limit, line, message, ...)                           \
+    {                                                                                            \
+        UNITY_TIME_TYPE _unityStart = UnityNowNs();                                              \
+        { __VA_ARGS__; }                                                                         \
+        UnityAssertDurationBelow((UNITY_TIME_TYPE)(limit), UnityNowNs() - _unityStart, (message), (UNITY_LINE_TYPE)line); \
+    }
+#define UNITY_TEST_BENCHMARK_BELOW_NS(repeats, limit, line, message, ...)                        \
+    {                                                                                            \
+        UNITY_TIME_TYPE _unityBest = 0;                                                          \
+        for (_UU32 _unityRun = 0; _unityRun < (_UU32)(repeats); _unityRun++)                     \
+        {                                                                                        \
+            UNITY_TIME_TYPE _unityStart = UnityNowNs();                                          \
+            { __VA_ARGS__; }                                                                     \
+            UNITY_TIME_TYPE _unityTime = UnityNowNs() - _unityStart;                             \
+            _unityBest = (_unityRun == 0 || _unityTime < _unityBest) ? _unityTime : _unityBest;  \
+        }                                                                                        \
+        UnityRecordBenchmark(_unityBest, (_UU32)(repeats));                                      \
+        UnityAssertDurationBelow((UNITY_TIME_TYPE)(limit), _unityBest, (message), (UNITY_LINE_TYPE)line); \
+    }
+#endif
+
 #ifdef UNITY_EXCLUDE_FLOAT
 #define UNITY_TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual, line, message)                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)line, "Unity Floating Point Disabled")
 #define UNITY_TEST_ASSERT_EQUAL_FLOAT(expected, actual, line, message)                           UNITY_TEST_FAIL((UNITY_LINE_TYPE)line, "Unity Floating Point Disabled")
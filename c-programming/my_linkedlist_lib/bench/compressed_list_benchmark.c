@@ -0,0 +1,97 @@
+/**
+ * @file compressed_list_benchmark.c
+ * @brief Memory and scan time of sorted 64-bit IDs: List against CompressedList
+ *
+ * Usage: compressed_list_benchmark [elements]
+ *
+ * The IDs grow by a random gap of 1 to 8. List memory is estimated from the
+ * node layout plus 16 bytes of malloc overhead per node; CompressedList
+ * reports the size of its blocks.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "compressed_list.h"
+#include "linked_list.h"
+
+#define REPEATS 5
+#define MALLOC_OVERHEAD 16
+
+static double NowMilliseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e3 + (double)now.tv_nsec / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    size_t elements = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    List* list = ListConstruct(sizeof(int64_t));
+    CompressedList* compressed = CompressedListConstruct();
+    int64_t id = 1000000;
+
+    srand(1);
+
+    for (size_t index = 0; index < elements; index++)
+    {
+        id += 1 + rand() % 8;
+        ListAddHead(list, &id);
+        CompressedListAppend(compressed, id);
+    }
+
+    double listScan = 0;
+    double compressedScan = 0;
+    int64_t listSum = 0;
+    int64_t compressedSum = 0;
+
+    for (int repeat = 0; repeat < REPEATS; repeat++)
+    {
+        double start = NowMilliseconds();
+        listSum = 0;
+
+        for (int64_t* value = ListGetHeadData(list); value != NULL; value = ListGetNextData(list))
+        {
+            listSum += *value;
+        }
+
+        double time = NowMilliseconds() - start;
+        listScan = repeat == 0 || time < listScan ? time : listScan;
+
+        start = NowMilliseconds();
+        compressedSum = 0;
+        int64_t value;
+
+        for (int found = CompressedListGetFirst(compressed, &value); found == 0;
+             found = CompressedListGetNext(compressed, &value))
+        {
+            compressedSum += value;
+        }
+
+        time = NowMilliseconds() - start;
+        compressedScan = repeat == 0 || time < compressedScan ? time : compressedScan;
+    }
+
+    if (listSum != compressedSum)
+    {
+        return 1;
+    }
+
+    /* Header and payload of a heap node, rounded like the list rounds them. */
+    double listBytes = (double)elements * (32 + 16 + MALLOC_OVERHEAD);
+    double compressedBytes = (double)CompressedListGetMemoryUsage(compressed);
+
+    printf("%zu sorted IDs, best of %d\n", elements, REPEATS);
+    printf("%-16s %14s %12s\n", "container", "bytes/element", "scan ms");
+    printf("%-16s %14.2f %12.2f\n", "List", listBytes / (double)elements, listScan);
+    printf("%-16s %14.2f %12.2f\n", "CompressedList", compressedBytes / (double)elements, compressedScan);
+
+    ListDestruct(&list);
+    CompressedListDestruct(&compressed);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file epoch_benchmark.c
+ * @brief Read throughput of a read-mostly List: reader/writer lock against RCU mode
+ *
+ * Usage: epoch_benchmark [milliseconds per run]
+ *
+ * Every reader repeatedly sums a 64-element list while one writer thread
+ * replaces an element every millisecond. With the lock each traversal takes
+ * the read side of a pthread_rwlock_t; in RCU mode it only enters and leaves
+ * an epoch.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "epoch.h"
+#include "linked_list.h"
+
+#define LIST_ELEMENTS 64
+#define MAXIMUM_READERS 8
+
+typedef struct shared Shared;
+struct shared
+{
+    List* list;
+    EpochDomain* domain;
+    pthread_rwlock_t lock;
+    int useRcu;
+    int stop;
+};
+
+typedef struct reader Reader;
+struct reader
+{
+    Shared* shared;
+    pthread_t thread;
+    unsigned long long traversals;
+    long long checksum;
+};
+
+static void* RunReader(void* argument)
+{
+    Reader* reader = argument;
+    Shared* shared = reader->shared;
+    EpochReader* epochReader = EpochReaderRegister(shared->domain);
+
+    while (!__atomic_load_n(&shared->stop, __ATOMIC_RELAXED))
+    {
+        long long sum = 0;
+
+        if (shared->useRcu)
+        {
+            EpochEnter(epochReader);
+
+            for (const int* value = ListRcuGetHeadData(shared->list); value != NULL;
+                 value = ListRcuGetNextData(shared->list, value))
+            {
+                sum += *value;
+            }
+
+            EpochExit(epochReader);
+        }
+        else
+        {
+            pthread_rwlock_rdlock(&shared->lock);
+
+            /* The cursor functions write the list, so locked readers use the RCU walk as well. */
+            for (const int* value = ListRcuGetHeadData(shared->list); value != NULL;
+                 value = ListRcuGetNextData(shared->list, value))
+            {
+                sum += *value;
+            }
+
+            pthread_rwlock_unlock(&shared->lock);
+        }
+
+        reader->checksum += sum;
+        reader->traversals++;
+    }
+
+    EpochReaderUnregister(&epochReader);
+
+    return NULL;
+}
+
+static void SleepMilliseconds(long milliseconds)
+{
+    struct timespec duration = {milliseconds / 1000, (milliseconds % 1000) * 1000000L};
+    nanosleep(&duration, NULL);
+}
+
+static void* RunWriter(void* argument)
+{
+    Shared* shared = argument;
+
+    for (int value = LIST_ELEMENTS; !__atomic_load_n(&shared->stop, __ATOMIC_RELAXED); value++)
+    {
+        SleepMilliseconds(1);
+        pthread_rwlock_wrlock(&shared->lock);
+        ListRemoveHead(shared->list);
+        ListAddTail(shared->list, &value);
+        pthread_rwlock_unlock(&shared->lock);
+    }
+
+    return NULL;
+}
+
+static void Measure(int useRcu, int readerCount, long milliseconds)
+{
+    Shared shared = {ListConstruct(sizeof(int)), EpochDomainConstruct(), PTHREAD_RWLOCK_INITIALIZER, useRcu, 0};
+    Reader readers[MAXIMUM_READERS];
+    pthread_t writer;
+
+    if (useRcu)
+    {
+        ListEnableRcu(shared.list, shared.domain);
+    }
+
+    for (int value = 0; value < LIST_ELEMENTS; value++)
+    {
+        ListAddTail(shared.list, &value);
+    }
+
+    for (int index = 0; index < readerCount; index++)
+    {
+        readers[index] = (Reader){&shared, 0, 0, 0};
+        pthread_create(&readers[index].thread, NULL, RunReader, &readers[index]);
+    }
+
+    pthread_create(&writer, NULL, RunWriter, &shared);
+    SleepMilliseconds(milliseconds);
+    __atomic_store_n(&shared.stop, 1, __ATOMIC_RELAXED);
+    pthread_join(writer, NULL);
+
+    unsigned long long traversals = 0;
+
+    for (int index = 0; index < readerCount; index++)
+    {
+        pthread_join(readers[index].thread, NULL);
+        traversals += readers[index].traversals;
+    }
+
+    ListDestruct(&shared.list);
+    EpochDomainDestruct(&shared.domain);
+    pthread_rwlock_destroy(&shared.lock);
+
+    printf("%-10s %8d %16.2f\n", useRcu ? "RCU" : "rwlock", readerCount,
+           (double)traversals / ((double)milliseconds / 1000.0) / 1e6);
+}
+
+int main(int argc, char** argv)
+{
+    long milliseconds = argc > 1 ? strtol(argv[1], NULL, 10) : 500;
+    int readerCounts[] = {1, 2, 4, 8};
+
+    printf("%-10s %8s %16s\n", "mode", "readers", "Mtraversals/s");
+
+    for (size_t index = 0; index < sizeof(readerCounts) / sizeof(readerCounts[0]); index++)
+    {
+        Measure(0, readerCounts[index], milliseconds);
+        Measure(1, readerCounts[index], milliseconds);
+    }
+
+    return 0;
+}
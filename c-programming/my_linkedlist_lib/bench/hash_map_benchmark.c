@@ -0,0 +1,132 @@
+/**
+ * @file hash_map_benchmark.c
+ * @brief Compares HashMap lookups with the List scan they replace
+ *
+ * Usage: hash_map_benchmark [lookups]
+ *
+ * For every size the structure holds keys 0..n-1 and is queried with an even
+ * mix of present and absent keys. The List is searched the way ListRemove
+ * does, walking from the head and comparing each element with memcmp.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hash_map.h"
+#include "linked_list.h"
+
+#define LIST_SCAN_BUDGET 50000000ULL
+
+typedef struct record Record;
+struct record
+{
+    int key;
+    int payload;
+};
+
+static double NowNanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static int QueryKey(size_t index, int size)
+{
+    unsigned int mixed = (unsigned int)index * 2654435761u;
+
+    /* Odd queries miss by asking for a key beyond the stored range. */
+    return (int)(mixed % (unsigned int)size) + ((index & 1) ? size : 0);
+}
+
+static double MeasureHashMap(int size, size_t lookups, size_t* hits)
+{
+    HashMap* map = HashMapConstruct(sizeof(int), sizeof(int));
+
+    for (int key = 0; key < size; key++)
+    {
+        HashMapPut(map, &key, &key);
+    }
+
+    *hits = 0;
+    double start = NowNanoseconds();
+
+    for (size_t index = 0; index < lookups; index++)
+    {
+        int key = QueryKey(index, size);
+        *hits += HashMapGet(map, &key) != NULL;
+    }
+
+    double elapsed = NowNanoseconds() - start;
+    HashMapDestruct(&map);
+
+    return elapsed / (double)lookups;
+}
+
+static double MeasureListScan(int size, size_t lookups, size_t* hits)
+{
+    List* list = ListConstruct(sizeof(Record));
+
+    for (int key = size - 1; key >= 0; key--)
+    {
+        Record record = {key, key};
+        ListAddHead(list, &record);
+    }
+
+    *hits = 0;
+    double start = NowNanoseconds();
+
+    for (size_t index = 0; index < lookups; index++)
+    {
+        int key = QueryKey(index, size);
+
+        for (Record* record = ListGetHeadData(list); record != NULL; record = ListGetNextData(list))
+        {
+            if (memcmp(&record->key, &key, sizeof(key)) == 0)
+            {
+                (*hits)++;
+                break;
+            }
+        }
+    }
+
+    double elapsed = NowNanoseconds() - start;
+    ListDestruct(&list);
+
+    return elapsed / (double)lookups;
+}
+
+int main(int argc, char** argv)
+{
+    size_t lookups = argc > 1 ? strtoul(argv[1], NULL, 10) : 2000000;
+    int sizes[] = {16, 256, 4096, 65536, 1048576};
+
+    printf("%-10s %16s %16s %10s\n", "size", "HashMap(ns/op)", "List scan(ns/op)", "speedup");
+
+    for (size_t index = 0; index < sizeof(sizes) / sizeof(sizes[0]); index++)
+    {
+        size_t mapHits;
+        size_t listHits;
+        size_t listLookups = (size_t)(LIST_SCAN_BUDGET / (unsigned long long)sizes[index]);
+
+        listLookups = listLookups < lookups ? listLookups : lookups;
+        listLookups = listLookups > 0 ? listLookups : 1;
+
+        double mapTime = MeasureHashMap(sizes[index], lookups, &mapHits);
+        double listTime = MeasureListScan(sizes[index], listLookups, &listHits);
+
+        if (mapHits != (lookups + 1) / 2 || listHits != (listLookups + 1) / 2)
+        {
+            fprintf(stderr, "unexpected hit count\n");
+            return 1;
+        }
+
+        printf("%-10d %16.1f %16.1f %9.1fx\n", sizes[index], mapTime, listTime, listTime / mapTime);
+    }
+
+    return 0;
+}
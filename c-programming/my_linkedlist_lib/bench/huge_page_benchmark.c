@@ -0,0 +1,208 @@
+/**
+ * @file huge_page_benchmark.c
+ * @brief Scan time and dTLB load misses of a scattered list: malloc nodes against huge-page slabs
+ *
+ * Usage: huge_page_benchmark [elements]
+ *
+ * Both lists get the same elements inserted at random positions, so that
+ * consecutive elements sit far apart in memory and a scan touches pages in
+ * random order. The dTLB load misses of the scans are counted with
+ * perf_event_open when the kernel allows it (perf_event_paranoid of 2 or
+ * less is enough for a process counting itself); otherwise they are shown
+ * as n/a and only the times are compared.
+ */
+
+#define _GNU_SOURCE
+
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include "linked_list.h"
+
+#define REPEATS 5
+
+typedef struct scan_result ScanResult;
+struct scan_result
+{
+    double milliseconds;
+    long long dtlbMisses;
+};
+
+static double NowMilliseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e3 + (double)now.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Opens a disabled counter of the dTLB load misses of this thread in user space.
+ *
+ * @return File descriptor of the counter, or -1 if it is not available.
+ */
+static int OpenDtlbCounter(void)
+{
+    struct perf_event_attr attributes;
+
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HW_CACHE;
+    attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+
+    return (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+static void FillScattered(List* list, size_t elements)
+{
+    ListEnableIndex(list);
+    srand(1);
+
+    for (size_t index = 0; index < elements; index++)
+    {
+        int64_t value = (int64_t)index;
+        size_t position = (size_t)(((unsigned long)rand() << 16 ^ (unsigned long)rand()) % (index + 1));
+
+        ListInsertAt(list, position, &value);
+    }
+}
+
+/**
+ * @brief Scans the list REPEATS times and keeps the fastest scan.
+ */
+static ScanResult Scan(List* list, int counter, int64_t* sum)
+{
+    ScanResult best = {0, -1};
+
+    for (int repeat = 0; repeat < REPEATS; repeat++)
+    {
+        long long misses = -1;
+
+        if (counter != -1)
+        {
+            ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+            ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+        }
+
+        double start = NowMilliseconds();
+        *sum = 0;
+
+        for (int64_t* value = ListGetHeadData(list); value != NULL; value = ListGetNextData(list))
+        {
+            *sum += *value;
+        }
+
+        double time = NowMilliseconds() - start;
+
+        if (counter != -1)
+        {
+            ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+
+            if (read(counter, &misses, sizeof(misses)) != sizeof(misses))
+            {
+                misses = -1;
+            }
+        }
+
+        if (repeat == 0 || time < best.milliseconds)
+        {
+            best.milliseconds = time;
+            best.dtlbMisses = misses;
+        }
+    }
+
+    return best;
+}
+
+static void PrintResult(const char* name, ScanResult result, size_t elements)
+{
+    if (result.dtlbMisses < 0)
+    {
+        printf("%-12s %10.2f %14s %14s\n", name, result.milliseconds, "n/a", "n/a");
+    }
+    else
+    {
+        printf("%-12s %10.2f %14lld %14.3f\n", name, result.milliseconds, result.dtlbMisses,
+               (double)result.dtlbMisses / (double)elements);
+    }
+}
+
+static void PrintTransparentHugePages(void)
+{
+    char setting[128] = "unknown";
+    FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+    if (file != NULL)
+    {
+        if (fgets(setting, sizeof(setting), file) != NULL)
+        {
+            setting[strcspn(setting, "\n")] = '\0';
+        }
+
+        fclose(file);
+    }
+
+    printf("transparent huge pages: %s\n", setting);
+}
+
+int main(int argc, char** argv)
+{
+    size_t elements = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    List* mallocList = ListConstruct(sizeof(int64_t));
+    List* hugeList = ListConstruct(sizeof(int64_t));
+
+    if (ListEnableHugePages(hugeList) == -1)
+    {
+        printf("huge page slabs could not be mapped\n");
+        return 1;
+    }
+
+    FillScattered(mallocList, elements);
+    FillScattered(hugeList, elements);
+
+    int counter = OpenDtlbCounter();
+    int64_t mallocSum;
+    int64_t hugeSum;
+    ScanResult mallocResult = Scan(mallocList, counter, &mallocSum);
+    ScanResult hugeResult = Scan(hugeList, counter, &hugeSum);
+
+    if (mallocSum != hugeSum)
+    {
+        return 1;
+    }
+
+    printf("%zu elements at random positions, best of %d scans\n", elements, REPEATS);
+    PrintTransparentHugePages();
+    printf("%-12s %10s %14s %14s\n", "nodes", "scan ms", "dTLB misses", "misses/elem");
+    PrintResult("malloc", mallocResult, elements);
+    PrintResult("huge pages", hugeResult, elements);
+
+    if (mallocResult.dtlbMisses > 0 && hugeResult.dtlbMisses >= 0)
+    {
+        printf("dTLB miss reduction: %.1f%%\n",
+               100.0 * (1.0 - (double)hugeResult.dtlbMisses / (double)mallocResult.dtlbMisses));
+    }
+    else
+    {
+        printf("dTLB miss counter not available (perf_event_open failed)\n");
+    }
+
+    if (counter != -1)
+    {
+        close(counter);
+    }
+
+    ListDestruct(&mallocList);
+    ListDestruct(&hugeList);
+
+    return 0;
+}
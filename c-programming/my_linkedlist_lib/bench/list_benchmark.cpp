@@ -0,0 +1,658 @@
+/**
+ * @file list_benchmark.cpp
+ * @brief Compares utilities::List with std::list and the C List on insert, scan and erase
+ *
+ * Usage: list_benchmark [elements]
+ *
+ * A second table shows how ListReduceParallel scales with the thread count,
+ * a third one passes heap-allocated messages through the C List by copy and
+ * by ownership transfer (ListAdoptHead/ListDetachHead), a fourth one runs a
+ * deduplication workload of mostly failing ListRemove calls with and without
+ * the Bloom filter, a fifth one jumps to random positions with ListGetAt
+ * with and without the positional index, a sixth one shows how long
+ * ListDestruct and ListDestructAsync block the calling thread, a seventh
+ * one builds a list over an array of parsed records by copy and as a view,
+ * and an eighth one exports those lists back to an array with a
+ * ListGetNextData loop and with ListCopyInto.
+ *
+ * Every measurement is repeated and the best time is reported, so that no
+ * container is charged for the page faults of growing the heap.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+#include "linked_list.h"
+#include "list.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static const int REPEATS = 5;
+
+struct Timings
+{
+    double emplace;
+    double scan;
+    double erase;
+};
+
+template <typename Function>
+static double MeasureMilliseconds(Function function)
+{
+    Clock::time_point start = Clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template <typename Round>
+static void Report(const char* name, Round round)
+{
+    Timings best = round();
+
+    for (int i = 1; i < REPEATS; i++)
+    {
+        Timings timings = round();
+        best.emplace = std::min(best.emplace, timings.emplace);
+        best.scan = std::min(best.scan, timings.scan);
+        best.erase = std::min(best.erase, timings.erase);
+    }
+
+    std::printf("%-26s %12.2f %12.2f %12.2f\n", name, best.emplace, best.scan, best.erase);
+}
+
+template <typename Container>
+static Timings StringRound(std::size_t elements)
+{
+    Container container;
+    std::size_t checksum = 0;
+    Timings timings;
+
+    timings.emplace = MeasureMilliseconds([&] {
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            container.emplace_back(32, static_cast<char>('a' + i % 26));
+        }
+    });
+
+    timings.scan = MeasureMilliseconds([&] {
+        for (const std::string& value : container)
+        {
+            checksum += static_cast<unsigned char>(value[0]);
+        }
+    });
+
+    timings.erase = MeasureMilliseconds([&] {
+        while (!container.empty())
+        {
+            container.pop_front();
+        }
+    });
+
+    if (checksum == 0 && elements != 0)
+    {
+        std::abort();
+    }
+
+    return timings;
+}
+
+template <typename Container>
+static Timings IntRound(std::size_t elements)
+{
+    Container container;
+    long long checksum = 0;
+    Timings timings;
+
+    timings.emplace = MeasureMilliseconds([&] {
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            container.emplace_back(static_cast<int>(i));
+        }
+    });
+
+    timings.scan = MeasureMilliseconds([&] {
+        for (int value : container)
+        {
+            checksum += value;
+        }
+    });
+
+    timings.erase = MeasureMilliseconds([&] {
+        while (!container.empty())
+        {
+            container.pop_front();
+        }
+    });
+
+    if (checksum != static_cast<long long>(elements) * (static_cast<long long>(elements) - 1) / 2)
+    {
+        std::abort();
+    }
+
+    return timings;
+}
+
+static Timings CListIntRound(std::size_t elements)
+{
+    List* list = ListConstruct(sizeof(int));
+    long long checksum = 0;
+    Timings timings;
+
+    // ListAddTail walks to the tail, so build with ListAddHead in reverse order instead.
+    timings.emplace = MeasureMilliseconds([&] {
+        for (std::size_t i = elements; i > 0; i--)
+        {
+            int value = static_cast<int>(i - 1);
+            ListAddHead(list, &value);
+        }
+    });
+
+    timings.scan = MeasureMilliseconds([&] {
+        for (int* value = static_cast<int*>(ListGetHeadData(list)); value != nullptr;
+             value = static_cast<int*>(ListGetNextData(list)))
+        {
+            checksum += *value;
+        }
+    });
+
+    timings.erase = MeasureMilliseconds([&] {
+        while (ListRemoveHead(list) == 0)
+        {
+        }
+    });
+
+    ListDestruct(&list);
+
+    if (checksum != static_cast<long long>(elements) * (static_cast<long long>(elements) - 1) / 2)
+    {
+        std::abort();
+    }
+
+    return timings;
+}
+
+static Timings CListEmplaceRound(std::size_t elements)
+{
+    List* list = ListConstruct(sizeof(int));
+    long long checksum = 0;
+    Timings timings;
+
+    // The reservation is made outside the timed part, as a producer would at start-up.
+    ListReserve(list, elements);
+
+    timings.emplace = MeasureMilliseconds([&] {
+        for (std::size_t i = elements; i > 0; i--)
+        {
+            *static_cast<int*>(ListEmplaceHead(list)) = static_cast<int>(i - 1);
+        }
+    });
+
+    timings.scan = MeasureMilliseconds([&] {
+        for (int* value = static_cast<int*>(ListGetHeadData(list)); value != nullptr;
+             value = static_cast<int*>(ListGetNextData(list)))
+        {
+            checksum += *value;
+        }
+    });
+
+    timings.erase = MeasureMilliseconds([&] {
+        while (ListRemoveHead(list) == 0)
+        {
+        }
+    });
+
+    ListDestruct(&list);
+
+    if (checksum != static_cast<long long>(elements) * (static_cast<long long>(elements) - 1) / 2)
+    {
+        std::abort();
+    }
+
+    return timings;
+}
+
+static void SumInt(void* accumulator, const void* data, void*)
+{
+    *static_cast<long long*>(accumulator) += *static_cast<const int*>(data);
+}
+
+static void SumPartial(void* accumulator, const void* partial, void*)
+{
+    *static_cast<long long*>(accumulator) += *static_cast<const long long*>(partial);
+}
+
+static void ReportParallelScan(std::size_t elements)
+{
+    List* list = ListConstruct(sizeof(int));
+    int maximumThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    for (std::size_t i = elements; i > 0; i--)
+    {
+        int value = static_cast<int>(i - 1);
+        ListAddHead(list, &value);
+    }
+
+    std::printf("\n%-26s %12s %12s\n", "ListReduceParallel", "scan", "speedup");
+
+    double single = 0;
+
+    for (int threads = 1; threads <= maximumThreads; threads *= 2)
+    {
+        double best = 0;
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            long long checksum = 0;
+            double time = MeasureMilliseconds([&] {
+                ListReduceParallel(list, SumInt, SumPartial, &checksum, sizeof(checksum), nullptr, threads);
+            });
+
+            if (checksum != static_cast<long long>(elements) * (static_cast<long long>(elements) - 1) / 2)
+            {
+                std::abort();
+            }
+
+            best = i == 0 ? time : std::min(best, time);
+        }
+
+        single = threads == 1 ? best : single;
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "%d thread(s)", threads);
+        std::printf("%-26s %12.2f %11.2fx\n", name, best, best > 0 ? single / best : 0.0);
+    }
+
+    ListDestruct(&list);
+}
+
+static const std::size_t MESSAGE_SIZE = 256;
+
+struct Message
+{
+    std::size_t sequence;
+    unsigned char payload[MESSAGE_SIZE - sizeof(std::size_t)];
+};
+
+static Message* NewMessage(std::size_t sequence)
+{
+    Message* message = static_cast<Message*>(std::malloc(sizeof(Message)));
+    message->sequence = sequence;
+    std::memset(message->payload, static_cast<int>(sequence), sizeof(message->payload));
+    return message;
+}
+
+/**
+ * Producers hand over heap messages and consumers take them back, as in a
+ * work queue. The copying variant pays for a memcpy into the list and one
+ * out of it; the adopting variant only moves the pointer.
+ */
+static void ReportPassThrough(std::size_t elements)
+{
+    std::printf("\n%-26s %12s %12s\n", "pass-through 256 B", "enqueue", "dequeue");
+
+    for (int adopt = 0; adopt < 2; adopt++)
+    {
+        double bestEnqueue = 0;
+        double bestDequeue = 0;
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            List* list = ListConstruct(sizeof(Message));
+            std::size_t checksum = 0;
+
+            double enqueue = MeasureMilliseconds([&] {
+                for (std::size_t sequence = 0; sequence < elements; sequence++)
+                {
+                    Message* message = NewMessage(sequence);
+
+                    if (adopt)
+                    {
+                        ListAdoptHead(list, message);
+                    }
+                    else
+                    {
+                        ListAddHead(list, message);
+                        std::free(message);
+                    }
+                }
+            });
+
+            double dequeue = MeasureMilliseconds([&] {
+                for (;;)
+                {
+                    Message* message;
+
+                    if (adopt)
+                    {
+                        message = static_cast<Message*>(ListDetachHead(list));
+                    }
+                    else
+                    {
+                        Message* head = static_cast<Message*>(ListGetHeadData(list));
+                        message = head != nullptr ? static_cast<Message*>(std::malloc(sizeof(Message))) : nullptr;
+
+                        if (message != nullptr)
+                        {
+                            std::memcpy(message, head, sizeof(Message));
+                            ListRemoveHead(list);
+                        }
+                    }
+
+                    if (message == nullptr)
+                    {
+                        break;
+                    }
+
+                    checksum += message->sequence;
+                    std::free(message);
+                }
+            });
+
+            ListDestruct(&list);
+
+            if (checksum != elements * (elements - 1) / 2)
+            {
+                std::abort();
+            }
+
+            bestEnqueue = i == 0 ? enqueue : std::min(bestEnqueue, enqueue);
+            bestDequeue = i == 0 ? dequeue : std::min(bestDequeue, dequeue);
+        }
+
+        std::printf("%-26s %12.2f %12.2f\n", adopt ? "ListAdopt/DetachHead" : "ListAddHead + copy out",
+                    bestEnqueue, bestDequeue);
+    }
+}
+
+static const int DEDUP_ELEMENTS = 10000;
+static const int DEDUP_LOOKUPS = 10000;
+
+/**
+ * Nine out of ten lookups ask for a value that is not in the list and, without
+ * the filter, walk all of it. Every hit is added back so the list stays full.
+ */
+static void ReportFilteredLookups()
+{
+    std::printf("\n%-26s %12s\n", "dedup, 90% misses", "lookups");
+
+    for (int filter = 0; filter < 2; filter++)
+    {
+        List* list = ListConstruct(sizeof(int));
+        double best = 0;
+
+        if (filter)
+        {
+            ListEnableFilter(list, DEDUP_ELEMENTS);
+        }
+
+        for (int value = 0; value < DEDUP_ELEMENTS; value++)
+        {
+            ListAddTail(list, &value);
+        }
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            int hits = 0;
+            double time = MeasureMilliseconds([&] {
+                for (int lookup = 0; lookup < DEDUP_LOOKUPS; lookup++)
+                {
+                    int value = lookup % 10 == 0 ? lookup : DEDUP_ELEMENTS + lookup;
+
+                    if (ListRemove(list, &value) == 0)
+                    {
+                        ListAddTail(list, &value);
+                        hits++;
+                    }
+                }
+            });
+
+            if (hits != DEDUP_LOOKUPS / 10)
+            {
+                std::abort();
+            }
+
+            best = i == 0 ? time : std::min(best, time);
+        }
+
+        std::printf("%-26s %12.2f\n", filter ? "ListRemove, filtered" : "ListRemove", best);
+
+        ListDestruct(&list);
+    }
+}
+
+static const int PAGE_LOOKUPS = 100;
+
+static void ReportPositionalAccess(std::size_t elements)
+{
+    std::printf("\n%-26s %12s\n", "ListGetAt, random", "lookups");
+
+    for (int indexed = 0; indexed < 2; indexed++)
+    {
+        List* list = ListConstruct(sizeof(int));
+        double best = 0;
+
+        for (std::size_t i = elements; i > 0; i--)
+        {
+            int value = static_cast<int>(i - 1);
+            ListAddHead(list, &value);
+        }
+
+        if (indexed)
+        {
+            ListEnableIndex(list);
+        }
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            std::srand(1);
+            double time = MeasureMilliseconds([&] {
+                for (int lookup = 0; lookup < PAGE_LOOKUPS; lookup++)
+                {
+                    std::size_t position = static_cast<std::size_t>(std::rand()) % elements;
+
+                    if (*static_cast<int*>(ListGetAt(list, position)) != static_cast<int>(position))
+                    {
+                        std::abort();
+                    }
+                }
+            });
+
+            best = i == 0 ? time : std::min(best, time);
+        }
+
+        std::printf("%-26s %12.3f\n", indexed ? "order-statistic index" : "walk", best);
+
+        ListDestruct(&list);
+    }
+}
+
+static void ReportDestruct(std::size_t elements)
+{
+    std::printf("\n%-26s %12s\n", "destruct", "caller");
+
+    for (int async = 0; async < 2; async++)
+    {
+        double best = 0;
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            List* list = ListConstruct(sizeof(int));
+
+            for (std::size_t j = 0; j < elements; j++)
+            {
+                int value = static_cast<int>(j);
+                ListAddHead(list, &value);
+            }
+
+            double time = MeasureMilliseconds([&] {
+                if (async)
+                {
+                    ListDestructAsync(&list);
+                }
+                else
+                {
+                    ListDestruct(&list);
+                }
+            });
+
+            ListReclaimerDrain();
+            best = i == 0 ? time : std::min(best, time);
+        }
+
+        std::printf("%-26s %12.3f\n", async ? "ListDestructAsync" : "ListDestruct", best);
+    }
+}
+
+struct Record
+{
+    int id;
+    char payload[60];
+};
+
+static void ReportView(std::size_t elements)
+{
+    std::vector<Record> records(elements);
+
+    for (std::size_t j = 0; j < elements; j++)
+    {
+        records[j].id = static_cast<int>(j);
+        std::memset(records[j].payload, static_cast<int>(j), sizeof(records[j].payload));
+    }
+
+    std::printf("\n%-26s %12s %12s\n", "64 B records from array", "build", "scan");
+
+    for (int view = 0; view < 2; view++)
+    {
+        double bestBuild = 0;
+        double bestScan = 0;
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            List* list = nullptr;
+            double build = MeasureMilliseconds([&] {
+                if (view)
+                {
+                    list = ListConstructView(records.data(), elements, sizeof(Record));
+                    return;
+                }
+
+                list = ListConstruct(sizeof(Record));
+
+                for (std::size_t j = elements; j > 0; j--)
+                {
+                    ListAddHead(list, &records[j - 1]);
+                }
+            });
+
+            long long sum = 0;
+            double scan = MeasureMilliseconds([&] {
+                for (void* data = ListGetHeadData(list); data != nullptr; data = ListGetNextData(list))
+                {
+                    sum += static_cast<Record*>(data)->id;
+                }
+            });
+
+            if (sum < 0)
+            {
+                std::printf("unexpected sum\n");
+            }
+
+            ListDestruct(&list);
+            bestBuild = i == 0 ? build : std::min(bestBuild, build);
+            bestScan = i == 0 ? scan : std::min(bestScan, scan);
+        }
+
+        std::printf("%-26s %12.3f %12.3f\n", view ? "ListConstructView" : "ListAddHead (copy)", bestBuild, bestScan);
+    }
+}
+
+static void ReportExport(std::size_t elements)
+{
+    std::vector<Record> records(elements);
+    std::vector<Record> exported(elements);
+
+    for (std::size_t j = 0; j < elements; j++)
+    {
+        records[j].id = static_cast<int>(j);
+    }
+
+    std::printf("\n%-26s %12s %12s\n", "export 64 B records", "loop", "ListCopyInto");
+
+    for (int view = 0; view < 2; view++)
+    {
+        List* list = nullptr;
+
+        if (view)
+        {
+            list = ListConstructView(records.data(), elements, sizeof(Record));
+        }
+        else
+        {
+            list = ListConstruct(sizeof(Record));
+
+            for (std::size_t j = elements; j > 0; j--)
+            {
+                ListAddHead(list, &records[j - 1]);
+            }
+        }
+
+        double bestLoop = 0;
+        double bestCopy = 0;
+
+        for (int i = 0; i < REPEATS; i++)
+        {
+            double loop = MeasureMilliseconds([&] {
+                Record* destination = exported.data();
+
+                for (void* data = ListGetHeadData(list); data != nullptr; data = ListGetNextData(list))
+                {
+                    std::memcpy(destination++, data, sizeof(Record));
+                }
+            });
+
+            double copy = MeasureMilliseconds([&] { ListCopyInto(list, exported.data(), elements); });
+
+            bestLoop = i == 0 ? loop : std::min(bestLoop, loop);
+            bestCopy = i == 0 ? copy : std::min(bestCopy, copy);
+        }
+
+        if (elements > 0 && exported[elements - 1].id != static_cast<int>(elements - 1))
+        {
+            std::printf("unexpected export\n");
+        }
+
+        std::printf("%-26s %12.3f %12.3f\n", view ? "view" : "copied list", bestLoop, bestCopy);
+        ListDestruct(&list);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::printf("%zu elements, best of %d, times in ms\n", elements, REPEATS);
+    std::printf("%-26s %12s %12s %12s\n", "container", "emplace", "scan", "pop_front");
+
+    Report("utilities::List<int>", [&] { return IntRound<utilities::List<int>>(elements); });
+    Report("std::list<int>", [&] { return IntRound<std::list<int>>(elements); });
+    Report("C List (void*, memcpy)", [&] { return CListIntRound(elements); });
+    Report("C List (emplace, reserved)", [&] { return CListEmplaceRound(elements); });
+    Report("utilities::List<string>", [&] { return StringRound<utilities::List<std::string>>(elements); });
+    Report("std::list<string>", [&] { return StringRound<std::list<std::string>>(elements); });
+
+    ReportParallelScan(elements);
+    ReportPassThrough(elements);
+    ReportFilteredLookups();
+    ReportPositionalAccess(elements);
+    ReportDestruct(elements);
+    ReportView(elements);
+    ReportExport(elements);
+
+    return 0;
+}
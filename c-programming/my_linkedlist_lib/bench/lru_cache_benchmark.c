@@ -0,0 +1,188 @@
+/**
+ * @file lru_cache_benchmark.c
+ * @brief Hit rate and throughput of LruCache under a Zipf-distributed key trace
+ *
+ * Usage: lru_cache_benchmark [keys] [operations]
+ *
+ * Each operation is a read-through lookup: get, and put on a miss. The same
+ * workload is run against the List-based LRU that LruCache replaces (touch as
+ * ListRemove + ListAddHead) on a shortened trace, since that one is O(n) per
+ * operation.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "lru_cache.h"
+
+#define ZIPF_EXPONENT 0.99
+#define LIST_BASELINE_OPERATIONS 20000
+
+static double NowSeconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static unsigned long long NextRandom(unsigned long long* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+/**
+ * @brief Draws a trace of key ranks from a Zipf distribution by inverting its cumulative distribution.
+ */
+static int* CreateZipfTrace(int keys, size_t operations)
+{
+    double* cumulative = malloc(sizeof(double) * keys);
+    int* trace = malloc(sizeof(int) * operations);
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+    double total = 0;
+
+    if (cumulative == NULL || trace == NULL)
+    {
+        free(cumulative);
+        free(trace);
+        return NULL;
+    }
+
+    for (int rank = 0; rank < keys; rank++)
+    {
+        total += 1.0 / pow(rank + 1, ZIPF_EXPONENT);
+        cumulative[rank] = total;
+    }
+
+    for (size_t index = 0; index < operations; index++)
+    {
+        double target = (double)(NextRandom(&state) >> 11) / 9007199254740992.0 * total;
+        int low = 0;
+        int high = keys - 1;
+
+        while (low < high)
+        {
+            int middle = low + (high - low) / 2;
+
+            if (cumulative[middle] < target)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        /* Scatter the ranks so that hot keys are not neighbours. */
+        trace[index] = (int)(((unsigned int)low * 2654435761u) % (unsigned int)keys);
+    }
+
+    free(cumulative);
+
+    return trace;
+}
+
+static void RunLruCache(const int* trace, size_t operations, size_t capacity)
+{
+    LruCache* cache = LruCacheConstruct(sizeof(int), sizeof(long), capacity, NULL, NULL);
+    size_t hits = 0;
+    double start = NowSeconds();
+
+    for (size_t index = 0; index < operations; index++)
+    {
+        int key = trace[index];
+
+        if (LruCacheGet(cache, &key) != NULL)
+        {
+            hits++;
+        }
+        else
+        {
+            long value = key;
+            LruCachePut(cache, &key, &value);
+        }
+    }
+
+    double elapsed = NowSeconds() - start;
+
+    printf("%-22s %10zu %10zu %9.2f%% %12.2f\n", "LruCache", capacity, operations,
+           100.0 * (double)hits / (double)operations, (double)operations / elapsed / 1e6);
+
+    LruCacheDestruct(&cache);
+}
+
+static void RunListLru(const int* trace, size_t operations, size_t capacity)
+{
+    List* list = ListConstruct(sizeof(int));
+    size_t hits = 0;
+    double start = NowSeconds();
+
+    for (size_t index = 0; index < operations; index++)
+    {
+        int key = trace[index];
+
+        if (ListRemove(list, &key) == 0)
+        {
+            hits++;
+        }
+        else if (ListGetLength(list) == capacity)
+        {
+            ListRemoveTail(list);
+        }
+
+        ListAddHead(list, &key);
+    }
+
+    double elapsed = NowSeconds() - start;
+
+    printf("%-22s %10zu %10zu %9.2f%% %12.2f\n", "List + ListRemove", capacity, operations,
+           100.0 * (double)hits / (double)operations, (double)operations / elapsed / 1e6);
+
+    ListDestruct(&list);
+}
+
+int main(int argc, char** argv)
+{
+    int keys = argc > 1 ? atoi(argv[1]) : 1000000;
+    size_t operations = argc > 2 ? strtoul(argv[2], NULL, 10) : 5000000;
+
+    if (keys <= 0 || operations == 0)
+    {
+        fprintf(stderr, "usage: %s [keys] [operations]\n", argv[0]);
+        return 1;
+    }
+
+    int* trace = CreateZipfTrace(keys, operations);
+
+    if (trace == NULL)
+    {
+        return 1;
+    }
+
+    size_t baselineOperations = operations < LIST_BASELINE_OPERATIONS ? operations : LIST_BASELINE_OPERATIONS;
+    size_t capacities[] = {(size_t)keys / 1000, (size_t)keys / 100, (size_t)keys / 10};
+
+    printf("%d keys, Zipf exponent %.2f\n", keys, ZIPF_EXPONENT);
+    printf("%-22s %10s %10s %10s %12s\n", "cache", "capacity", "operations", "hit rate", "Mops/s");
+
+    for (size_t index = 0; index < sizeof(capacities) / sizeof(capacities[0]); index++)
+    {
+        size_t capacity = capacities[index] > 0 ? capacities[index] : 1;
+
+        RunLruCache(trace, operations, capacity);
+        RunListLru(trace, baselineOperations, capacity);
+    }
+
+    free(trace);
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file priority_queue_benchmark.c
+ * @brief Push/pop throughput of PriorityQueue per arity, against a sorted List
+ *
+ * Usage: priority_queue_benchmark [elements]
+ *
+ * Every queue receives the same random priorities and is then drained. The
+ * sorted List keeps its order with a scan for the insertion point plus
+ * ListAddBefore, and runs on a shortened input because each push is O(n).
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "priority_queue.h"
+
+#define LIST_ELEMENTS 20000
+
+typedef struct task Task;
+struct task
+{
+    long long deadline;
+    int id;
+    int payload[6];
+};
+
+static double NowNanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static int CompareTasks(const void* a, const void* b, void* context)
+{
+    (void)context;
+    const Task* left = a;
+    const Task* right = b;
+
+    return (left->deadline > right->deadline) - (left->deadline < right->deadline);
+}
+
+static Task* CreateTasks(size_t count)
+{
+    Task* tasks = calloc(count, sizeof(Task));
+    unsigned long long state = 88172645463325252ULL;
+
+    for (size_t index = 0; tasks != NULL && index < count; index++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        tasks[index].deadline = (long long)(state >> 1);
+        tasks[index].id = (int)index;
+    }
+
+    return tasks;
+}
+
+static void MeasureQueue(const Task* tasks, size_t count, int arity)
+{
+    PriorityQueue* queue = PriorityQueueConstruct(sizeof(Task), arity, CompareTasks, NULL);
+    Task task;
+    long long previous = -1;
+
+    double start = NowNanoseconds();
+
+    for (size_t index = 0; index < count; index++)
+    {
+        PriorityQueuePush(queue, &tasks[index], NULL);
+    }
+
+    double pushed = NowNanoseconds();
+
+    while (PriorityQueuePop(queue, &task) == 0)
+    {
+        if (task.deadline < previous)
+        {
+            abort();
+        }
+
+        previous = task.deadline;
+    }
+
+    double popped = NowNanoseconds();
+    PriorityQueueDestruct(&queue);
+
+    queue = NULL;
+    double heapifyStart = NowNanoseconds();
+    queue = PriorityQueueConstructFromArray(sizeof(Task), arity, CompareTasks, NULL, tasks, count);
+    double heapified = NowNanoseconds();
+    PriorityQueueDestruct(&queue);
+
+    char name[32];
+    snprintf(name, sizeof(name), "PriorityQueue, %d-ary", arity);
+    printf("%-24s %10zu %12.1f %12.1f %12.1f\n", name, count, (pushed - start) / (double)count,
+           (popped - pushed) / (double)count, (heapified - heapifyStart) / (double)count);
+}
+
+static void MeasureSortedList(const Task* tasks, size_t count)
+{
+    List* list = ListConstruct(sizeof(Task));
+    double start = NowNanoseconds();
+
+    for (size_t index = 0; index < count; index++)
+    {
+        Task* current = ListGetHeadData(list);
+
+        while (current != NULL && current->deadline <= tasks[index].deadline)
+        {
+            current = ListGetNextData(list);
+        }
+
+        if (current != NULL)
+        {
+            ListAddBefore(list, (void*)&tasks[index], current);
+        }
+        else
+        {
+            ListAddTail(list, (void*)&tasks[index]);
+        }
+    }
+
+    double pushed = NowNanoseconds();
+
+    while (ListRemoveHead(list) == 0)
+    {
+    }
+
+    double popped = NowNanoseconds();
+    ListDestruct(&list);
+
+    printf("%-24s %10zu %12.1f %12.1f %12s\n", "sorted List", count, (pushed - start) / (double)count,
+           (popped - pushed) / (double)count, "-");
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    Task* tasks = CreateTasks(count);
+    int arities[] = {2, 4, 8, 16};
+
+    if (tasks == NULL)
+    {
+        return 1;
+    }
+
+    printf("%-24s %10s %12s %12s %12s\n", "container", "elements", "push(ns)", "pop(ns)", "heapify(ns)");
+
+    for (size_t index = 0; index < sizeof(arities) / sizeof(arities[0]); index++)
+    {
+        MeasureQueue(tasks, count, arities[index]);
+    }
+
+    MeasureSortedList(tasks, count < LIST_ELEMENTS ? count : LIST_ELEMENTS);
+    free(tasks);
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file thread_pool_benchmark.c
+ * @brief Measures the scheduling overhead of the work-stealing thread pool
+ *
+ * Usage: thread_pool_benchmark [tasks]
+ *
+ * Tiny tasks show the per-task cost of submit, steal and completion tracking.
+ * Large tasks show how close the pool gets to linear scaling when scheduling
+ * is negligible. Every measurement reports the best of several repetitions.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "thread_pool.h"
+
+#define REPEATS 5
+#define LARGE_TASK_ITERATIONS 1000000
+
+static volatile unsigned long long sink;
+
+static double NowNanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static void EmptyTask(void* argument)
+{
+    (void)argument;
+}
+
+static void LargeTask(void* argument)
+{
+    unsigned long long value = (unsigned long long)(size_t)argument;
+
+    for (int iteration = 0; iteration < LARGE_TASK_ITERATIONS; iteration++)
+    {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+
+    sink += value & 1;
+}
+
+static void TinyRange(size_t begin, size_t end, void* context)
+{
+    (void)context;
+    sink += end - begin;
+}
+
+/**
+ * @brief Submits every task from the calling thread and waits for all of them.
+ */
+static double MeasureSubmitWait(ThreadPool* pool, ThreadPoolTaskFunction function, size_t tasks)
+{
+    double best = 0;
+
+    for (int repeat = 0; repeat < REPEATS; repeat++)
+    {
+        ThreadPoolGroup group;
+        ThreadPoolGroupInit(&group);
+        double start = NowNanoseconds();
+
+        for (size_t index = 0; index < tasks; index++)
+        {
+            ThreadPoolSubmit(pool, &group, function, (void*)index);
+        }
+
+        ThreadPoolWait(pool, &group);
+        double elapsed = NowNanoseconds() - start;
+        best = repeat == 0 || elapsed < best ? elapsed : best;
+    }
+
+    return best;
+}
+
+static double MeasureParallelFor(ThreadPool* pool, size_t indices, size_t grain)
+{
+    double best = 0;
+
+    for (int repeat = 0; repeat < REPEATS; repeat++)
+    {
+        double start = NowNanoseconds();
+        ThreadPoolParallelFor(pool, 0, indices, grain, TinyRange, NULL);
+        double elapsed = NowNanoseconds() - start;
+        best = repeat == 0 || elapsed < best ? elapsed : best;
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    size_t tasks = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+    size_t largeTasks = 64;
+    ThreadPool* pool = ThreadPoolConstruct(0);
+    int threadCount = ThreadPoolGetThreadCount(pool);
+
+    printf("%d worker(s), best of %d\n", threadCount, REPEATS);
+    printf("%-34s %14s %14s\n", "workload", "total(ms)", "per task(ns)");
+
+    double time = MeasureSubmitWait(pool, EmptyTask, tasks);
+    printf("%-34s %14.2f %14.1f\n", "submit+wait, empty tasks", time / 1e6, time / (double)tasks);
+
+    size_t grains[] = {1, 64, 4096};
+
+    for (size_t index = 0; index < sizeof(grains) / sizeof(grains[0]); index++)
+    {
+        char name[64];
+        size_t indices = tasks * grains[index];
+        size_t chunks = (indices + grains[index] - 1) / grains[index];
+
+        snprintf(name, sizeof(name), "parallel-for, grain %zu", grains[index]);
+        time = MeasureParallelFor(pool, indices, grains[index]);
+        printf("%-34s %14.2f %14.1f\n", name, time / 1e6, time / (double)chunks);
+    }
+
+    printf("\n%-34s %14s %14s\n", "large tasks", "total(ms)", "speedup");
+
+    ThreadPool* single = ThreadPoolConstruct(1);
+    double serial = MeasureSubmitWait(single, LargeTask, largeTasks);
+    ThreadPoolDestruct(&single);
+
+    printf("%-34s %14.2f %13.2fx\n", "1 worker + caller", serial / 1e6, 1.0);
+
+    time = MeasureSubmitWait(pool, LargeTask, largeTasks);
+    char name[64];
+    snprintf(name, sizeof(name), "%d worker(s) + caller", threadCount);
+    printf("%-34s %14.2f %13.2fx\n", name, time / 1e6, serial / time);
+
+    ThreadPoolDestruct(&pool);
+
+    return 0;
+}
@@ -0,0 +1,428 @@
+/**
+ * @file compressed_list.c
+ * @author Manuel Haulez
+ * @brief Append-only list of 64-bit integers stored as delta-encoded varints
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * A block is one BLOCK_SIZE allocation: a header followed by the varint
+ * bytes. A new block is started when the next delta no longer fits. The
+ * decoder has an SSE2 path for sixteen consecutive deltas that each fit in
+ * one byte, the common case for dense IDs: the bytes are zigzag-decoded in
+ * 16-bit lanes and turned into running sums with three shifted adds per
+ * eight lanes.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "compressed_list.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define BLOCK_SIZE 256
+#define MAXIMUM_VARINT_BYTES 10
+
+typedef struct block Block;
+struct block
+{
+    Block* next;
+    int64_t first;
+    int64_t last;
+    int64_t minimum;
+    int64_t maximum;
+    uint16_t count;
+    uint16_t used;
+    unsigned char bytes[];
+};
+
+#define BLOCK_CAPACITY (BLOCK_SIZE - sizeof(Block))
+#define BLOCK_MAXIMUM_VALUES (BLOCK_CAPACITY + 1)
+
+struct compressed_list
+{
+    Block* head;
+    Block* tail;
+    size_t length;
+    size_t blockCount;
+    int sorted;
+    Block* cursorBlock;
+    size_t cursorIndex;
+    size_t decodedCount;
+    int64_t decoded[BLOCK_MAXIMUM_VALUES];
+};
+
+/**
+ * @brief Writes the zigzag varint of the difference between two values.
+ *
+ * @return Number of bytes written.
+ */
+static size_t EncodeDelta(unsigned char* bytes, int64_t previous, int64_t value)
+{
+    uint64_t delta = (uint64_t)value - (uint64_t)previous;
+    uint64_t zigzag = (delta << 1) ^ (uint64_t)((int64_t)delta >> 63);
+    size_t length = 0;
+
+    while (zigzag >= 0x80)
+    {
+        bytes[length++] = (unsigned char)(zigzag | 0x80);
+        zigzag >>= 7;
+    }
+
+    bytes[length++] = (unsigned char)zigzag;
+
+    return length;
+}
+
+#ifdef __SSE2__
+/**
+ * @brief Zigzag-decodes eight one-byte deltas held in 16-bit lanes and returns their running sums.
+ */
+static __m128i PrefixSumDeltas(__m128i lanes)
+{
+    __m128i one = _mm_set1_epi16(1);
+    __m128i sign = _mm_sub_epi16(_mm_setzero_si128(), _mm_and_si128(lanes, one));
+    __m128i deltas = _mm_xor_si128(_mm_srli_epi16(lanes, 1), sign);
+
+    deltas = _mm_add_epi16(deltas, _mm_slli_si128(deltas, 2));
+    deltas = _mm_add_epi16(deltas, _mm_slli_si128(deltas, 4));
+    deltas = _mm_add_epi16(deltas, _mm_slli_si128(deltas, 8));
+
+    return deltas;
+}
+#endif
+
+/**
+ * @brief Decodes every value of a block.
+ *
+ * @return Number of values written to values.
+ */
+static size_t DecodeBlock(const Block* block, int64_t* values)
+{
+    int64_t value = block->first;
+    size_t count = 0;
+    size_t offset = 0;
+
+    values[count++] = value;
+
+    while (offset < block->used)
+    {
+#ifdef __SSE2__
+        if (block->used - offset >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)(block->bytes + offset));
+
+            if (_mm_movemask_epi8(bytes) == 0)
+            {
+                int16_t sums[16];
+                __m128i low = PrefixSumDeltas(_mm_unpacklo_epi8(bytes, _mm_setzero_si128()));
+                __m128i high = PrefixSumDeltas(_mm_unpackhi_epi8(bytes, _mm_setzero_si128()));
+
+                _mm_storeu_si128((__m128i*)sums, low);
+                _mm_storeu_si128((__m128i*)(sums + 8), high);
+
+                for (int lane = 0; lane < 16; lane++)
+                {
+                    int64_t base = lane < 8 ? value : values[count + 7];
+                    values[count + lane] = (int64_t)((uint64_t)base + (uint64_t)(int64_t)sums[lane]);
+                }
+
+                value = values[count + 15];
+                count += 16;
+                offset += 16;
+                continue;
+            }
+        }
+#endif
+        uint64_t zigzag = 0;
+        int shift = 0;
+        unsigned char byte;
+
+        do
+        {
+            byte = block->bytes[offset++];
+            zigzag |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        value = (int64_t)((uint64_t)value + ((zigzag >> 1) ^ (0 - (zigzag & 1))));
+        values[count++] = value;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Appends a block holding a single value.
+ */
+static int AddBlock(CompressedList* this, int64_t value)
+{
+    Block* newBlock = malloc(BLOCK_SIZE);
+
+    if (newBlock == NULL)
+    {
+        return -1;
+    }
+
+    newBlock->next = NULL;
+    newBlock->first = value;
+    newBlock->last = value;
+    newBlock->minimum = value;
+    newBlock->maximum = value;
+    newBlock->count = 1;
+    newBlock->used = 0;
+
+    if (this->tail == NULL)
+    {
+        this->head = newBlock;
+    }
+    else
+    {
+        this->tail->next = newBlock;
+    }
+
+    this->tail = newBlock;
+    this->blockCount++;
+
+    return 0;
+}
+
+/**
+ * @brief Constructs an empty compressed list.
+ *
+ * @return Pointer to the new list, or NULL on failure.
+ */
+CompressedList* CompressedListConstruct(void)
+{
+    CompressedList* newList = malloc(sizeof(CompressedList));
+
+    if (newList == NULL)
+    {
+        return NULL;
+    }
+
+    memset(newList, 0, offsetof(CompressedList, decoded));
+    newList->sorted = 1;
+
+    return newList;
+}
+
+/**
+ * @brief Destructs a compressed list and frees all of its blocks.
+ *
+ * @param Double pointer to the list.
+ * @return Error code indicating the success of the operation.
+ */
+int CompressedListDestruct(CompressedList** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    CompressedListClear(*this);
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Appends a value to the end of the list.
+ *
+ * @param List pointer.
+ * @param Value to be appended.
+ * @return Error code indicating the success of the operation.
+ */
+int CompressedListAppend(CompressedList* this, int64_t value)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    Block* tail = this->tail;
+    unsigned char encoded[MAXIMUM_VARINT_BYTES];
+    size_t encodedLength = tail != NULL ? EncodeDelta(encoded, tail->last, value) : 0;
+
+    if (tail != NULL && value < tail->last)
+    {
+        this->sorted = 0;
+    }
+
+    if (tail == NULL || tail->used + encodedLength > BLOCK_CAPACITY)
+    {
+        if (AddBlock(this, value) == -1)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        memcpy(tail->bytes + tail->used, encoded, encodedLength);
+        tail->used += (uint16_t)encodedLength;
+        tail->count++;
+        tail->last = value;
+        tail->minimum = value < tail->minimum ? value : tail->minimum;
+        tail->maximum = value > tail->maximum ? value : tail->maximum;
+    }
+
+    this->length++;
+
+    return 0;
+}
+
+/**
+ * @brief Checks whether the list contains a value. Blocks whose range excludes it are not decoded.
+ *
+ * @param List pointer.
+ * @param Value to be searched.
+ * @return 1 if the value is found, 0 if not or if the list is NULL.
+ */
+int CompressedListContains(CompressedList* this, int64_t value)
+{
+    if (this == NULL)
+    {
+        return 0;
+    }
+
+    int64_t values[BLOCK_MAXIMUM_VALUES];
+
+    for (Block* block = this->head; block != NULL; block = block->next)
+    {
+        if (value < block->minimum)
+        {
+            if (this->sorted)
+            {
+                return 0;
+            }
+
+            continue;
+        }
+
+        if (value > block->maximum)
+        {
+            continue;
+        }
+
+        size_t count = DecodeBlock(block, values);
+
+        for (size_t index = 0; index < count; index++)
+        {
+            if (values[index] == value)
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Removes every value from the list.
+ *
+ * @param List pointer.
+ * @return Error code indicating the success of the operation.
+ */
+int CompressedListClear(CompressedList* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    Block* block = this->head;
+
+    while (block != NULL)
+    {
+        Block* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    memset(this, 0, offsetof(CompressedList, decoded));
+    this->sorted = 1;
+
+    return 0;
+}
+
+/**
+ * @brief Moves the cursor to the first value.
+ *
+ * @param List pointer.
+ * @param Receives the first value.
+ * @return Error code indicating the success of the operation; -1 if the list is empty.
+ */
+int CompressedListGetFirst(CompressedList* this, int64_t* value)
+{
+    if (this == NULL || value == NULL || this->head == NULL)
+    {
+        return -1;
+    }
+
+    this->cursorBlock = this->head;
+    this->decodedCount = DecodeBlock(this->head, this->decoded);
+    this->cursorIndex = 0;
+    *value = this->decoded[0];
+
+    return 0;
+}
+
+/**
+ * @brief Advances the cursor to the next value.
+ *
+ * @param List pointer.
+ * @param Receives the next value.
+ * @return Error code indicating the success of the operation; -1 at the end of the list.
+ */
+int CompressedListGetNext(CompressedList* this, int64_t* value)
+{
+    if (this == NULL || value == NULL || this->cursorBlock == NULL)
+    {
+        return -1;
+    }
+
+    if (this->cursorIndex + 1 >= this->decodedCount)
+    {
+        if (this->cursorBlock->count > this->decodedCount)
+        {
+            this->decodedCount = DecodeBlock(this->cursorBlock, this->decoded);
+        }
+        else if (this->cursorBlock->next != NULL)
+        {
+            this->cursorBlock = this->cursorBlock->next;
+            this->decodedCount = DecodeBlock(this->cursorBlock, this->decoded);
+            this->cursorIndex = 0;
+            *value = this->decoded[0];
+            return 0;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+
+    *value = this->decoded[++this->cursorIndex];
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the number of values in the list.
+ */
+size_t CompressedListGetLength(CompressedList* this)
+{
+    return this != NULL ? this->length : 0;
+}
+
+/**
+ * @brief Retrieves the number of bytes held by the blocks of the list.
+ */
+size_t CompressedListGetMemoryUsage(CompressedList* this)
+{
+    return this != NULL ? this->blockCount * BLOCK_SIZE : 0;
+}
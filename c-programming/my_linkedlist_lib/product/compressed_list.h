@@ -0,0 +1,53 @@
+/**
+ * @file compressed_list.h
+ * @author Manuel Haulez
+ * @brief Append-only list of 64-bit integers stored as delta-encoded varints
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Values are kept in insertion order in fixed-size blocks. A block stores its
+ * first value as is and every further value as the zigzag-encoded difference
+ * to its predecessor in LEB128 varint form, so sorted IDs with small gaps
+ * take about one byte each. Every block also records its minimum and maximum,
+ * letting searches skip blocks that cannot contain the value. Iteration
+ * decodes one block at a time, sixteen one-byte deltas at once with SSE2
+ * when available.
+ */
+
+#ifndef COMPRESSED_LIST_H
+#define COMPRESSED_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct compressed_list CompressedList;
+
+CompressedList* CompressedListConstruct(void);
+int CompressedListDestruct(CompressedList**);
+
+int CompressedListAppend(CompressedList*, int64_t value);
+int CompressedListContains(CompressedList*, int64_t value);
+int CompressedListClear(CompressedList*);
+
+/**
+ * The list has one cursor, like List: GetFirst moves it to the first value
+ * and GetNext advances it. Both return 0 and store the value, or -1 at the
+ * end of the list. Appending does not invalidate the cursor.
+ */
+int CompressedListGetFirst(CompressedList*, int64_t* value);
+int CompressedListGetNext(CompressedList*, int64_t* value);
+
+size_t CompressedListGetLength(CompressedList*);
+size_t CompressedListGetMemoryUsage(CompressedList*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
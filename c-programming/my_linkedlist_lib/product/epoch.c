@@ -0,0 +1,385 @@
+/**
+ * @file epoch.c
+ * @author Manuel Haulez
+ * @brief Epoch-based memory reclamation
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The domain keeps a global epoch. A reader entering a critical section
+ * publishes the epoch it saw in its own slot, followed by a full fence; on
+ * exit it clears the slot. The epoch only advances once every active reader
+ * has announced the current epoch, so an object retired in epoch e can no
+ * longer be referenced once the global epoch has reached e + 2. Advancing
+ * and freeing happen under the domain mutex, on whichever writer thread
+ * retires or synchronises.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include "epoch.h"
+
+#define CACHE_LINE_SIZE 64
+#define RECLAIM_THRESHOLD 64
+
+/* A reader slot holds 0 while the reader is outside, epoch * 2 + 1 inside. */
+struct epoch_reader
+{
+    unsigned long slot __attribute__((aligned(CACHE_LINE_SIZE)));
+    EpochDomain* domain;
+    EpochReader* next;
+};
+
+typedef struct retired Retired;
+struct retired
+{
+    void* object;
+    EpochFreeFunction free;
+    void* context;
+    unsigned long epoch;
+    Retired* next;
+};
+
+struct epoch_domain
+{
+    unsigned long epoch __attribute__((aligned(CACHE_LINE_SIZE)));
+    pthread_mutex_t mutex __attribute__((aligned(CACHE_LINE_SIZE)));
+    EpochReader* readers;
+    Retired* retired;
+    size_t pendingCount;
+};
+
+static EpochDomain* defaultDomain;
+static pthread_once_t defaultDomainOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Advances the global epoch if every active reader has seen the current one. Caller holds the mutex.
+ */
+static void TryAdvance(EpochDomain* this)
+{
+    unsigned long epoch = this->epoch;
+
+    /* Orders the writer's unlinking stores before the reads of the reader slots. */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    for (EpochReader* reader = this->readers; reader != NULL; reader = reader->next)
+    {
+        unsigned long slot = __atomic_load_n(&reader->slot, __ATOMIC_ACQUIRE);
+
+        if (slot != 0 && slot >> 1 != epoch)
+        {
+            return;
+        }
+    }
+
+    __atomic_store_n(&this->epoch, epoch + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Frees every retired object whose grace period has passed. Caller holds the mutex.
+ *
+ * @return Number of objects freed.
+ */
+static size_t FreeExpired(EpochDomain* this)
+{
+    size_t freedCount = 0;
+    Retired** link = &this->retired;
+
+    while (*link != NULL)
+    {
+        Retired* retired = *link;
+
+        if (retired->epoch + 2 > this->epoch)
+        {
+            link = &retired->next;
+            continue;
+        }
+
+        *link = retired->next;
+        retired->free(retired->object, retired->context);
+        free(retired);
+        freedCount++;
+    }
+
+    this->pendingCount -= freedCount;
+
+    return freedCount;
+}
+
+static void ConstructDefaultDomain(void)
+{
+    defaultDomain = EpochDomainConstruct();
+}
+
+/**
+ * @brief Creates a reclamation domain without readers.
+ *
+ * @return Pointer to the new domain, or NULL on failure.
+ */
+EpochDomain* EpochDomainConstruct(void)
+{
+    void* memory;
+
+    if (posix_memalign(&memory, CACHE_LINE_SIZE, sizeof(EpochDomain)) != 0)
+    {
+        return NULL;
+    }
+
+    EpochDomain* this = memory;
+    memset(this, 0, sizeof(EpochDomain));
+
+    if (pthread_mutex_init(&this->mutex, NULL) != 0)
+    {
+        free(this);
+        return NULL;
+    }
+
+    return this;
+}
+
+/**
+ * @brief Frees all pending objects and the domain. No reader may be registered any more.
+ *
+ * @param Double pointer to the domain.
+ * @return Error code indicating the success of the operation; -1 while readers are registered.
+ */
+int EpochDomainDestruct(EpochDomain** this)
+{
+    if (this == NULL || *this == NULL || (*this)->readers != NULL)
+    {
+        return -1;
+    }
+
+    Retired* retired = (*this)->retired;
+
+    while (retired != NULL)
+    {
+        Retired* next = retired->next;
+        retired->free(retired->object, retired->context);
+        free(retired);
+        retired = next;
+    }
+
+    pthread_mutex_destroy(&(*this)->mutex);
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the process-wide domain, created on first use.
+ *
+ * @return The default domain, or NULL if it could not be created.
+ */
+EpochDomain* EpochDomainGetDefault(void)
+{
+    pthread_once(&defaultDomainOnce, ConstructDefaultDomain);
+
+    return defaultDomain;
+}
+
+/**
+ * @brief Registers the calling thread as a reader of the domain.
+ *
+ * @param Domain pointer.
+ * @return Pointer to the reader, or NULL on failure.
+ */
+EpochReader* EpochReaderRegister(EpochDomain* this)
+{
+    void* memory;
+
+    if (this == NULL || posix_memalign(&memory, CACHE_LINE_SIZE, sizeof(EpochReader)) != 0)
+    {
+        return NULL;
+    }
+
+    EpochReader* reader = memory;
+    memset(reader, 0, sizeof(EpochReader));
+    reader->domain = this;
+
+    pthread_mutex_lock(&this->mutex);
+    reader->next = this->readers;
+    this->readers = reader;
+    pthread_mutex_unlock(&this->mutex);
+
+    return reader;
+}
+
+/**
+ * @brief Removes a reader from its domain. The reader must be outside any critical section.
+ *
+ * @param Double pointer to the reader.
+ * @return Error code indicating the success of the operation.
+ */
+int EpochReaderUnregister(EpochReader** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    EpochDomain* domain = (*this)->domain;
+
+    pthread_mutex_lock(&domain->mutex);
+
+    for (EpochReader** link = &domain->readers; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == *this)
+        {
+            *link = (*this)->next;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&domain->mutex);
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Starts a read-side critical section. Objects reached inside stay valid until EpochExit.
+ */
+void EpochEnter(EpochReader* this)
+{
+    unsigned long epoch = __atomic_load_n(&this->domain->epoch, __ATOMIC_ACQUIRE);
+
+    __atomic_store_n(&this->slot, epoch * 2 + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Ends a read-side critical section.
+ */
+void EpochExit(EpochReader* this)
+{
+    __atomic_store_n(&this->slot, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Hands an object that readers can no longer reach to the domain, to be freed after a grace period.
+ *
+ * Retiring also frees whatever older objects have become safe once enough
+ * of them are pending.
+ *
+ * @param Domain pointer.
+ * @param Object to be freed.
+ * @param Function that frees the object.
+ * @param Context pointer passed through to free.
+ * @return Error code indicating the success of the operation.
+ */
+int EpochRetire(EpochDomain* this, void* object, EpochFreeFunction freeFunction, void* context)
+{
+    if (this == NULL || freeFunction == NULL)
+    {
+        return -1;
+    }
+
+    Retired* retired = malloc(sizeof(Retired));
+
+    if (retired == NULL)
+    {
+        return -1;
+    }
+
+    retired->object = object;
+    retired->free = freeFunction;
+    retired->context = context;
+
+    pthread_mutex_lock(&this->mutex);
+    retired->epoch = this->epoch;
+    retired->next = this->retired;
+    this->retired = retired;
+
+    if (++this->pendingCount >= RECLAIM_THRESHOLD)
+    {
+        TryAdvance(this);
+        FreeExpired(this);
+    }
+
+    pthread_mutex_unlock(&this->mutex);
+
+    return 0;
+}
+
+/**
+ * @brief Advances the epoch as far as the active readers allow and frees the objects that became safe, without waiting.
+ *
+ * @param Domain pointer.
+ * @return Number of objects freed.
+ */
+size_t EpochReclaim(EpochDomain* this)
+{
+    if (this == NULL)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&this->mutex);
+    TryAdvance(this);
+    TryAdvance(this);
+    size_t freedCount = FreeExpired(this);
+    pthread_mutex_unlock(&this->mutex);
+
+    return freedCount;
+}
+
+/**
+ * @brief Waits for a full grace period and frees every object retired before the call.
+ *
+ * Must not be called from inside a critical section of the same domain.
+ *
+ * @param Domain pointer.
+ * @return Error code indicating the success of the operation.
+ */
+int EpochSynchronize(EpochDomain* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&this->mutex);
+    unsigned long target = this->epoch + 2;
+
+    while (this->epoch < target)
+    {
+        TryAdvance(this);
+
+        if (this->epoch < target)
+        {
+            pthread_mutex_unlock(&this->mutex);
+            sched_yield();
+            pthread_mutex_lock(&this->mutex);
+        }
+    }
+
+    FreeExpired(this);
+    pthread_mutex_unlock(&this->mutex);
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the number of retired objects not freed yet.
+ */
+size_t EpochGetPendingCount(EpochDomain* this)
+{
+    if (this == NULL)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&this->mutex);
+    size_t pendingCount = this->pendingCount;
+    pthread_mutex_unlock(&this->mutex);
+
+    return pendingCount;
+}
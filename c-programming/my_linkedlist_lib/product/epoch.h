@@ -0,0 +1,55 @@
+/**
+ * @file epoch.h
+ * @author Manuel Haulez
+ * @brief Epoch-based memory reclamation
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Readers bracket every traversal of a shared structure with EpochEnter and
+ * EpochExit. Writers unlink an object so that new readers can no longer
+ * reach it and hand it to EpochRetire; it is freed once every reader that
+ * might still hold a pointer to it has left its critical section. Entering
+ * and leaving only store to the reader's own cache line, so readers never
+ * contend with each other.
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct epoch_domain EpochDomain;
+typedef struct epoch_reader EpochReader;
+
+typedef void (*EpochFreeFunction)(void* object, void* context);
+
+EpochDomain* EpochDomainConstruct(void);
+int EpochDomainDestruct(EpochDomain**);
+EpochDomain* EpochDomainGetDefault(void);
+
+/**
+ * Every thread that reads registers once per domain and keeps the reader for
+ * as long as it reads. Critical sections must not be nested and must not
+ * wait for a grace period of their own domain.
+ */
+EpochReader* EpochReaderRegister(EpochDomain*);
+int EpochReaderUnregister(EpochReader**);
+void EpochEnter(EpochReader*);
+void EpochExit(EpochReader*);
+
+int EpochRetire(EpochDomain*, void* object, EpochFreeFunction freeFunction, void* context);
+size_t EpochReclaim(EpochDomain*);
+int EpochSynchronize(EpochDomain*);
+size_t EpochGetPendingCount(EpochDomain*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
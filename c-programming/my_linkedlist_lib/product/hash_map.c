@@ -0,0 +1,488 @@
+/**
+ * @file hash_map.c
+ * @author Manuel Haulez
+ * @brief Generic open-addressing hash map with fixed key and value sizes
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Slots are probed linearly from the key's home slot. The control bytes are
+ * followed by a copy of the first GROUP_WIDTH - 1 of them, so a window of
+ * GROUP_WIDTH bytes can be loaded at any slot without wrapping. Because
+ * removal closes gaps by backward shifting, a probe run never contains an
+ * empty slot and a lookup can stop at the first empty control byte.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hash_map.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define GROUP_WIDTH 16
+#define MINIMUM_CAPACITY 16
+#define CONTROL_EMPTY 0x80
+
+struct hash_map
+{
+    unsigned char* control;
+    uint64_t* hashes;
+    unsigned char* slots;
+    size_t capacity;
+    size_t size;
+    size_t slotSize;
+    size_t valueOffset;
+    int keySize;
+    int valueSize;
+};
+
+/**
+ * @brief Alignment of a field of the given size: its largest power-of-two divisor, at most 16.
+ */
+static size_t FieldAlignment(size_t size)
+{
+    size_t alignment = 1;
+
+    while (alignment < 16 && size % (alignment * 2) == 0 && size != 0)
+    {
+        alignment *= 2;
+    }
+
+    return alignment;
+}
+
+static size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static uint64_t MixBits(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
+
+static uint64_t HashKey(const void* key, int keySize)
+{
+    const unsigned char* bytes = key;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)keySize;
+    int index = 0;
+
+    for (; index + 8 <= keySize; index += 8)
+    {
+        uint64_t chunk;
+        memcpy(&chunk, bytes + index, sizeof(chunk));
+        hash = (hash ^ chunk) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
+    }
+
+    if (index < keySize)
+    {
+        uint64_t chunk = 0;
+        memcpy(&chunk, bytes + index, keySize - index);
+        hash = (hash ^ chunk) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    return MixBits(hash);
+}
+
+static unsigned char ControlByte(uint64_t hash)
+{
+    return (unsigned char)(hash >> 57);
+}
+
+static void* SlotKey(HashMap* this, size_t slot)
+{
+    return this->slots + slot * this->slotSize;
+}
+
+static void* SlotValue(HashMap* this, size_t slot)
+{
+    return this->slots + slot * this->slotSize + this->valueOffset;
+}
+
+static void SetControl(HashMap* this, size_t slot, unsigned char control)
+{
+    this->control[slot] = control;
+
+    if (slot < GROUP_WIDTH - 1)
+    {
+        this->control[this->capacity + slot] = control;
+    }
+}
+
+/**
+ * @brief Bit i of the result is set when control byte i of the window equals value.
+ */
+static unsigned int MatchWindow(const unsigned char* window, unsigned char value)
+{
+#ifdef __SSE2__
+    __m128i bytes = _mm_loadu_si128((const __m128i*)window);
+
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)value)));
+#else
+    unsigned int mask = 0;
+
+    for (int index = 0; index < GROUP_WIDTH; index++)
+    {
+        mask |= (unsigned int)(window[index] == value) << index;
+    }
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Finds the slot of a key.
+ *
+ * @return The slot index, or capacity if the key is absent.
+ */
+static size_t FindSlot(HashMap* this, const void* key, uint64_t hash)
+{
+    size_t mask = this->capacity - 1;
+    size_t position = hash & mask;
+    unsigned char control = ControlByte(hash);
+
+    for (;;)
+    {
+        const unsigned char* window = this->control + position;
+        unsigned int matches = MatchWindow(window, control);
+        unsigned int empties = MatchWindow(window, CONTROL_EMPTY);
+
+        if (empties != 0)
+        {
+            matches &= (empties & (0u - empties)) - 1;
+        }
+
+        while (matches != 0)
+        {
+            size_t slot = (position + (size_t)__builtin_ctz(matches)) & mask;
+
+            if (this->hashes[slot] == hash && memcmp(SlotKey(this, slot), key, this->keySize) == 0)
+            {
+                return slot;
+            }
+
+            matches &= matches - 1;
+        }
+
+        if (empties != 0)
+        {
+            return this->capacity;
+        }
+
+        position = (position + GROUP_WIDTH) & mask;
+    }
+}
+
+static size_t FindEmptySlot(HashMap* this, uint64_t hash)
+{
+    size_t mask = this->capacity - 1;
+    size_t position = hash & mask;
+
+    for (;;)
+    {
+        unsigned int empties = MatchWindow(this->control + position, CONTROL_EMPTY);
+
+        if (empties != 0)
+        {
+            return (position + (size_t)__builtin_ctz(empties)) & mask;
+        }
+
+        position = (position + GROUP_WIDTH) & mask;
+    }
+}
+
+static int AllocateTable(HashMap* this, size_t capacity)
+{
+    this->control = malloc(capacity + GROUP_WIDTH - 1);
+    this->hashes = malloc(sizeof(uint64_t) * capacity);
+    this->slots = malloc(this->slotSize * capacity);
+
+    if (this->control == NULL || this->hashes == NULL || this->slots == NULL)
+    {
+        free(this->control);
+        free(this->hashes);
+        free(this->slots);
+        return -1;
+    }
+
+    memset(this->control, CONTROL_EMPTY, capacity + GROUP_WIDTH - 1);
+    this->capacity = capacity;
+
+    return 0;
+}
+
+/**
+ * @brief Moves all entries into a table of the given capacity.
+ *
+ * @return Error code indicating the success of the operation.
+ */
+static int Resize(HashMap* this, size_t capacity)
+{
+    HashMap old = *this;
+
+    if (AllocateTable(this, capacity) == -1)
+    {
+        *this = old;
+        return -1;
+    }
+
+    for (size_t slot = 0; slot < old.capacity; slot++)
+    {
+        if (old.control[slot] != CONTROL_EMPTY)
+        {
+            size_t target = FindEmptySlot(this, old.hashes[slot]);
+            SetControl(this, target, old.control[slot]);
+            this->hashes[target] = old.hashes[slot];
+            memcpy(SlotKey(this, target), old.slots + slot * old.slotSize, this->slotSize);
+        }
+    }
+
+    free(old.control);
+    free(old.hashes);
+    free(old.slots);
+
+    return 0;
+}
+
+/**
+ * @brief Smallest power-of-two capacity that holds count entries at a load factor of at most 7/8.
+ */
+static size_t CapacityFor(size_t count)
+{
+    size_t capacity = MINIMUM_CAPACITY;
+
+    while (capacity - capacity / 8 < count)
+    {
+        capacity *= 2;
+    }
+
+    return capacity;
+}
+
+/**
+ * @brief Creates an empty hash map.
+ *
+ * @param Size of a key in bytes.
+ * @param Size of a value in bytes; 0 makes the map a set.
+ * @return Pointer to the new hash map, or NULL on failure.
+ */
+HashMap* HashMapConstruct(int keySize, int valueSize)
+{
+    if (keySize <= 0 || valueSize < 0)
+    {
+        return NULL;
+    }
+
+    HashMap* this = malloc(sizeof(HashMap));
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    memset(this, 0, sizeof(HashMap));
+
+    size_t keyAlignment = FieldAlignment((size_t)keySize);
+    size_t valueAlignment = FieldAlignment((size_t)valueSize);
+    size_t slotAlignment = keyAlignment > valueAlignment ? keyAlignment : valueAlignment;
+
+    this->keySize = keySize;
+    this->valueSize = valueSize;
+    this->valueOffset = AlignUp((size_t)keySize, valueAlignment);
+    this->slotSize = AlignUp(this->valueOffset + (size_t)valueSize, slotAlignment);
+
+    if (AllocateTable(this, MINIMUM_CAPACITY) == -1)
+    {
+        free(this);
+        return NULL;
+    }
+
+    return this;
+}
+
+/**
+ * @brief Frees the hash map with all its entries.
+ *
+ * @param Double pointer to the hash map.
+ * @return Error code indicating the success of the operation.
+ */
+int HashMapDestruct(HashMap** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    free((*this)->control);
+    free((*this)->hashes);
+    free((*this)->slots);
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Looks up the value of a key.
+ *
+ * @param Hash map pointer.
+ * @param Pointer to the key.
+ * @return Pointer to the stored value, or NULL if the key is absent. Valid until the next put or remove.
+ */
+void* HashMapGet(HashMap* this, const void* key)
+{
+    if (this == NULL || key == NULL)
+    {
+        return NULL;
+    }
+
+    size_t slot = FindSlot(this, key, HashKey(key, this->keySize));
+
+    return slot != this->capacity ? SlotValue(this, slot) : NULL;
+}
+
+/**
+ * @brief Inserts a key or replaces its value.
+ *
+ * @param Hash map pointer.
+ * @param Pointer to the key.
+ * @param Pointer to the value; may be NULL only if the value size is zero.
+ * @return Error code indicating the success of the operation.
+ */
+int HashMapPut(HashMap* this, const void* key, const void* value)
+{
+    if (this == NULL || key == NULL || (value == NULL && this->valueSize > 0))
+    {
+        return -1;
+    }
+
+    uint64_t hash = HashKey(key, this->keySize);
+    size_t slot = FindSlot(this, key, hash);
+
+    if (slot == this->capacity)
+    {
+        if (this->size + 1 > this->capacity - this->capacity / 8 &&
+            Resize(this, this->capacity * 2) == -1)
+        {
+            return -1;
+        }
+
+        slot = FindEmptySlot(this, hash);
+        SetControl(this, slot, ControlByte(hash));
+        this->hashes[slot] = hash;
+        memcpy(SlotKey(this, slot), key, this->keySize);
+        this->size++;
+    }
+
+    if (this->valueSize > 0)
+    {
+        memcpy(SlotValue(this, slot), value, this->valueSize);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Removes a key, shifting later entries of its probe run back into the gap.
+ *
+ * @param Hash map pointer.
+ * @param Pointer to the key.
+ * @return Error code indicating the success of the operation; -1 if the key is absent.
+ */
+int HashMapRemove(HashMap* this, const void* key)
+{
+    if (this == NULL || key == NULL)
+    {
+        return -1;
+    }
+
+    size_t gap = FindSlot(this, key, HashKey(key, this->keySize));
+
+    if (gap == this->capacity)
+    {
+        return -1;
+    }
+
+    size_t mask = this->capacity - 1;
+
+    for (size_t slot = (gap + 1) & mask; this->control[slot] != CONTROL_EMPTY; slot = (slot + 1) & mask)
+    {
+        size_t home = this->hashes[slot] & mask;
+
+        /* The entry may fill the gap if the gap lies on its probe path, i.e. in [home, slot). */
+        if (((slot - home) & mask) >= ((slot - gap) & mask))
+        {
+            SetControl(this, gap, this->control[slot]);
+            this->hashes[gap] = this->hashes[slot];
+            memcpy(SlotKey(this, gap), SlotKey(this, slot), this->slotSize);
+            gap = slot;
+        }
+    }
+
+    SetControl(this, gap, CONTROL_EMPTY);
+    this->size--;
+
+    return 0;
+}
+
+/**
+ * @brief Removes all entries, keeping the allocated capacity.
+ *
+ * @param Hash map pointer.
+ * @return Error code indicating the success of the operation.
+ */
+int HashMapClear(HashMap* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    memset(this->control, CONTROL_EMPTY, this->capacity + GROUP_WIDTH - 1);
+    this->size = 0;
+
+    return 0;
+}
+
+/**
+ * @brief Grows the table so that count entries fit without further resizing.
+ *
+ * @param Hash map pointer.
+ * @param Number of entries to make room for.
+ * @return Error code indicating the success of the operation.
+ */
+int HashMapReserve(HashMap* this, size_t count)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    size_t capacity = CapacityFor(count);
+
+    if (capacity <= this->capacity)
+    {
+        return 0;
+    }
+
+    return Resize(this, capacity);
+}
+
+/**
+ * @brief Retrieves the number of entries.
+ */
+size_t HashMapGetSize(HashMap* this)
+{
+    return this != NULL ? this->size : 0;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file hash_map.h
+ * @author Manuel Haulez
+ * @brief Generic open-addressing hash map with fixed key and value sizes
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Keys and values are copied into the map, like the data of a List, and keys
+ * are compared bytewise. Every slot has a control byte holding 7 bits of the
+ * key's hash, so a lookup compares 16 control bytes at once (SSE2 when
+ * available) and only touches keys whose bits match. Removal shifts the rest
+ * of the probe run back instead of leaving tombstones.
+ */
+
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct hash_map HashMap;
+
+HashMap* HashMapConstruct(int keySize, int valueSize);
+int HashMapDestruct(HashMap**);
+
+void* HashMapGet(HashMap*, const void* key);
+int HashMapPut(HashMap*, const void* key, const void* value);
+int HashMapRemove(HashMap*, const void* key);
+int HashMapClear(HashMap*);
+int HashMapReserve(HashMap*, size_t count);
+
+size_t HashMapGetSize(HashMap*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -4,493 +4,2413 @@
  * @brief Generic doubly linked list implementation
  * @version 0.1 2023-08-10 Initial version
  * @version 0.2 2023-08-18 Fixed prev pointer in ListAddAfterFunction
+ * @version 0.3 2026-10-19 Optional operation statistics (LIST_STATS)
+ * @version 0.4 2026-10-19 Optional sampled latency histograms (LIST_LATENCY)
+ * @version 0.5 2026-10-19 Central link/unlink helpers, length and structure version
+ * @version 0.6 2026-10-19 Inline node slots, node and payload in one block
+ * @version 0.7 2026-10-19 Deferred removal while snapshots are alive
+ * @version 0.8 2026-10-19 Nodes of RCU lists are retired to their epoch domain
+ * @version 0.9 2026-10-19 Adopting caller buffers as payload, detaching the head payload
+ * @version 0.10 2026-10-19 In-place emplacing, node pool filled by ListReserve
+ * @version 0.11 2026-10-19 Variable-length mode with slab-packed payloads
+ * @version 0.12 2026-10-19 Optional Bloom filter maintained on link and removal
+ * @version 0.13 2026-10-19 Positional access, optionally through an order-statistic index
+ * @version 0.14 2026-10-19 Node handles validated by the link version of the node
+ * @version 0.15 2026-10-19 Heap nodes carved from huge-page backed slabs
+ * @version 0.16 2026-10-19 Views over caller-owned arrays, moving elements to the head or tail
+ * @version 0.17 2026-10-19 Export to contiguous arrays
+ * @version 0.18 2026-10-19 Version stamps kept in node tracks, allocated only for tracked lists
  * @date 2023-08-18
- * 
+ *
  * @copyright Copyright (c) 2023
- * 
+ *
  */
 
-#include "linked_list.h"
+#include <stdint.h>
+#include "linked_list_internal.h"
+#include "list_latency.h"
 
-typedef struct node Node;
-struct node
+/**
+ * @brief Compares a stored element with reference data, accounting the call to the given operation.
+ */
+static int CompareData(List* this, ListOperation operation, const void* data, const void* refData)
 {
-    void* data;
-    Node* prev;
-    Node* next;
-};
+    (void)operation;
+    LIST_STATS_ADD(this, operation, compareCalls, 1);
+    return memcmp(data, refData, this->dataSize);
+}
+
+/**
+ * @brief Takes a free inline slot or, for full-size nodes, a pooled node; otherwise
+ *        allocates a heap block of the given size. Nodes of a tracked list get a track.
+ *
+ * @return Pointer to the new node with unset links and data, or NULL on failure.
+ */
+static Node* AllocateNode(List* this, ListOperation operation, size_t size)
+{
+    (void)operation;
+    NodeTrack* track = NULL;
+    Node* newNode;
+
+    if (this->tracked)
+    {
+        track = malloc(sizeof(NodeTrack));
+
+        if (track == NULL)
+        {
+            return NULL;
+        }
+
+        LIST_STATS_ADD(this, operation, allocations, 1);
+        track->addedVersion = 0;
+        track->removedVersion = LIST_NODE_ALIVE;
+        track->indexEntry = NULL;
+    }
+
+    if (this->inlineFree != 0)
+    {
+        int slot = __builtin_ctz(this->inlineFree);
+
+        this->inlineFree &= this->inlineFree - 1;
+        newNode = (Node*)(this->inlineSlots + (size_t)slot * this->slotSize);
+    }
+    else if (this->pool != NULL && (size == this->slotSize || this->hugeSlabs != NULL))
+    {
+        newNode = this->pool;
+        this->pool = newNode->next;
+        this->poolCount--;
+    }
+    else if (this->hugeSlabs != NULL)
+    {
+        newNode = ListHugeAllocate(this, operation);
+    }
+    else
+    {
+        newNode = malloc(size);
+
+        if (newNode != NULL)
+        {
+            LIST_STATS_ADD(this, operation, allocations, 1);
+        }
+    }
+
+    if (newNode == NULL)
+    {
+        free(track);
+        return NULL;
+    }
+
+    newNode->track = track;
+
+    return newNode;
+}
+
+/**
+ * @brief Creates a node holding a copy of the data directly behind its header.
+ *
+ * @return Pointer to the new node with unset links, or NULL on failure or for variable-length lists.
+ */
+static Node* CreateNode(List* this, ListOperation operation, const void* data)
+{
+    if (this->payloads != NULL)
+    {
+        return NULL;
+    }
+
+    Node* newNode = AllocateNode(this, operation, this->slotSize);
+
+    if (newNode == NULL)
+    {
+        return NULL;
+    }
+
+    newNode->data = (unsigned char*)newNode + LIST_ALIGN_SIZE(sizeof(Node));
+    LIST_STATS_ADD(this, operation, bytesCopied, this->dataSize);
+    memcpy(newNode->data, data, this->dataSize);
+
+    return newNode;
+}
+
+/**
+ * @brief Creates a node that takes over a heap buffer of the caller as its payload.
+ *
+ * RCU readers find a node from its embedded payload, so in RCU mode the
+ * buffer is copied into the node and freed instead. Variable-length lists
+ * cannot adopt buffers.
+ *
+ * @return Pointer to the new node with unset links, or NULL on failure; the buffer then still belongs to the caller.
+ */
+static Node* AdoptNode(List* this, ListOperation operation, void* data)
+{
+    if (this->payloads != NULL)
+    {
+        return NULL;
+    }
+
+    if (this->rcuDomain != NULL)
+    {
+        Node* newNode = CreateNode(this, operation, data);
+
+        if (newNode != NULL)
+        {
+            free(data);
+        }
+
+        return newNode;
+    }
+
+    Node* newNode = AllocateNode(this, operation, LIST_ALIGN_SIZE(sizeof(Node)));
+
+    if (newNode == NULL)
+    {
+        return NULL;
+    }
+
+    newNode->data = data;
+
+    return newNode;
+}
+
+/**
+ * @brief Creates a header-only node of a variable-length list whose payload is a copy packed in the arena.
+ *
+ * @return Pointer to the new node with unset links, or NULL on failure.
+ */
+static Node* CreateVariableNode(List* this, ListOperation operation, const void* data, size_t length)
+{
+    (void)operation;
+    size_t slabCount = SlabArenaGetSlabCount(this->payloads);
+    (void)slabCount;
+    void* payload = SlabArenaAllocate(this->payloads, length);
+
+    if (payload == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, operation, allocations, SlabArenaGetSlabCount(this->payloads) - slabCount);
+    Node* newNode = AllocateNode(this, operation, this->slotSize);
+
+    if (newNode == NULL)
+    {
+        SlabArenaRelease(payload);
+        return NULL;
+    }
+
+    newNode->data = payload;
+    LIST_STATS_ADD(this, operation, bytesCopied, length);
+    memcpy(newNode->data, data, length);
+
+    return newNode;
+}
+
+static void FreeRetired(void* object, void* context)
+{
+    (void)context;
+    free(object);
+}
+
+/**
+ * @brief Frees a retired node together with its track.
+ */
+static void FreeRetiredNode(void* object, void* context)
+{
+    (void)context;
+    free(((Node*)object)->track);
+    free(object);
+}
+
+/**
+ * @brief Releases a node that is no longer linked into the list, together with an
+ *        adopted payload. In RCU mode it is retired and freed once the readers
+ *        that may still hold it are gone.
+ */
+static void DestroyNode(List* this, Node* node)
+{
+    if (this->payloads != NULL)
+    {
+        SlabArenaRelease(node->data);
+    }
+    else if (ListIsAdoptedNode(node) && !ListIsViewNode(this, node))
+    {
+        free(node->data);
+    }
+
+    if (this->rcuDomain != NULL)
+    {
+        if (EpochRetire(this->rcuDomain, node, FreeRetiredNode, NULL) == -1)
+        {
+            EpochSynchronize(this->rcuDomain);
+            FreeRetiredNode(node, NULL);
+        }
+
+        return;
+    }
+
+    free(node->track);
+    node->track = NULL;
+
+    if (ListIsInlineNode(this, node))
+    {
+        size_t slot = (size_t)((unsigned char*)node - this->inlineSlots) / this->slotSize;
+        this->inlineFree |= 1u << slot;
+        return;
+    }
+
+    if (ListIsViewNode(this, node))
+    {
+        return;
+    }
+
+    if (this->hugeSlabs != NULL ||
+        ((this->payloads != NULL || !ListIsAdoptedNode(node)) && (this->poolCount < this->poolCapacity || this->handles)))
+    {
+        node->next = this->pool;
+        this->pool = node;
+        this->poolCount++;
+        return;
+    }
+
+    free(node);
+}
+
+/**
+ * @brief Checks whether any snapshot of the list is alive.
+ */
+static int HasSnapshots(List* this)
+{
+    return __atomic_load_n(&this->references, __ATOMIC_ACQUIRE) > 1;
+}
 
-struct list
+/**
+ * @brief Puts a node directly after previousNode, or at the head when previousNode is NULL.
+ *
+ * The node is fully initialised before the stores that make it reachable, so
+ * snapshot readers walking the list concurrently never see a partial node.
+ */
+static void SpliceNodeAfter(List* this, Node* previousNode, Node* node)
+{
+    node->prev = previousNode;
+    node->next = previousNode == NULL ? this->head : previousNode->next;
+
+    if (previousNode == NULL)
+    {
+        __atomic_store_n(&this->head, node, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        __atomic_store_n(&previousNode->next, node, __ATOMIC_RELEASE);
+    }
+
+    if (node->next != NULL)
+    {
+        __atomic_store_n(&node->next->prev, node, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Links a new node after previousNode and stamps it with the new list version.
+ */
+static void LinkNodeAfter(List* this, Node* previousNode, Node* newNode)
+{
+    this->length++;
+    this->version++;
+
+    if (newNode->track != NULL)
+    {
+        newNode->track->addedVersion = this->version;
+        newNode->track->removedVersion = LIST_NODE_ALIVE;
+    }
+
+    SpliceNodeAfter(this, previousNode, newNode);
+
+    if (this->filterCounters != NULL)
+    {
+        ListFilterInsert(this, newNode->data);
+    }
+
+    if (this->index != NULL)
+    {
+        ListIndexInsert(this, newNode);
+    }
+}
+
+/**
+ * @brief Unlinks a node from the list without freeing it. Only valid while no snapshot exists.
+ *
+ * The unlinked node keeps its own links, so an RCU reader standing on it can
+ * still move on.
+ */
+static void UnlinkNode(List* this, Node* node)
+{
+    if (node->prev == NULL)
+    {
+        __atomic_store_n(&this->head, node->next, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        __atomic_store_n(&node->prev->next, node->next, __ATOMIC_RELEASE);
+    }
+
+    if (node->next != NULL)
+    {
+        __atomic_store_n(&node->next->prev, node->prev, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Removes a node from the live list. It is freed at once, or only marked
+ *        as removed while snapshots may still walk over it.
+ */
+static void RemoveNode(List* this, Node* node)
+{
+    if (node == this->lastAccessed)
+    {
+        this->lastAccessed = NULL;
+    }
+
+    if (this->filterCounters != NULL && node->data != NULL)
+    {
+        ListFilterErase(this, node->data);
+    }
+
+    if (this->index != NULL)
+    {
+        ListIndexErase(this, node);
+    }
+
+    this->length--;
+    this->version++;
+
+    if (HasSnapshots(this))
+    {
+        __atomic_store_n(&node->track->removedVersion, this->version, __ATOMIC_RELAXED);
+        this->removedCount++;
+        return;
+    }
+
+    UnlinkNode(this, node);
+    DestroyNode(this, node);
+}
+
+/**
+ * @brief Frees the removed nodes kept for snapshots once no snapshot is left.
+ */
+static void PurgeRemoved(List* this)
+{
+    if (this->removedCount == 0 || HasSnapshots(this))
+    {
+        return;
+    }
+
+    Node* currentNode = this->head;
+
+    while (currentNode != NULL)
+    {
+        Node* nextNode = currentNode->next;
+
+        if (ListNodeRemovedVersion(currentNode) != LIST_NODE_ALIVE)
+        {
+            UnlinkNode(this, currentNode);
+            DestroyNode(this, currentNode);
+        }
+
+        currentNode = nextNode;
+    }
+
+    this->removedCount = 0;
+}
+
+/**
+ * @brief Asks the Bloom filter, if any, whether the reference data may be in the list.
+ *
+ * @return 0 if the filter rules the data out, 1 otherwise.
+ */
+static int FilterMayContain(List* this, const void* refData, size_t length)
+{
+    if (this->filterCounters == NULL || ListFilterMayContain(this, refData, length))
+    {
+        return 1;
+    }
+
+    LIST_STATS_ADD_FILTER(this, filterRejections, 1);
+
+    return 0;
+}
+
+/**
+ * @brief Counts a search that the Bloom filter let through but that found nothing.
+ *
+ * @return NULL, the result of the search.
+ */
+static Node* FilterMissed(List* this)
+{
+    if (this->filterCounters != NULL)
+    {
+        LIST_STATS_ADD_FILTER(this, filterFalsePositives, 1);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Finds the first node whose data equals the reference data.
+ *
+ * @return Pointer to the matching node, or NULL if there is none or the list is variable-length.
+ */
+static Node* FindNode(List* this, ListOperation operation, const void* refData)
+{
+    if (this->payloads != NULL || !FilterMayContain(this, refData, (size_t)this->dataSize))
+    {
+        return NULL;
+    }
+
+    Node* currentNode = ListSkipRemoved(this, this->head);
+
+    while (currentNode != NULL)
+    {
+        LIST_STATS_ADD(this, operation, nodesVisited, 1);
+
+        if (CompareData(this, operation, currentNode->data, refData) == 0)
+        {
+            return currentNode;
+        }
+
+        currentNode = ListSkipRemoved(this, currentNode->next);
+    }
+
+    return FilterMissed(this);
+}
+
+/**
+ * @brief Finds the first node of a variable-length list whose data equals the reference data.
+ *        Lengths are compared before any bytes.
+ *
+ * @return Pointer to the matching node, or NULL if there is none.
+ */
+static Node* FindVariableNode(List* this, ListOperation operation, const void* refData, size_t length)
 {
-    Node* head;
-    Node* lastAccessed;
-    int dataSize;
-};
+    (void)operation;
+
+    if (!FilterMayContain(this, refData, length))
+    {
+        return NULL;
+    }
+
+    Node* currentNode = ListSkipRemoved(this, this->head);
+
+    while (currentNode != NULL)
+    {
+        LIST_STATS_ADD(this, operation, nodesVisited, 1);
+
+        if (SlabArenaGetSize(currentNode->data) == length)
+        {
+            LIST_STATS_ADD(this, operation, compareCalls, 1);
+
+            if (memcmp(currentNode->data, refData, length) == 0)
+            {
+                return currentNode;
+            }
+        }
+
+        currentNode = ListSkipRemoved(this, currentNode->next);
+    }
+
+    return FilterMissed(this);
+}
+
+/**
+ * @brief Checks whether a view list is still exactly its array: no element added, removed or moved.
+ *
+ * Then the node at a position is the view node at that position, and the
+ * payloads from there on are the rest of the array.
+ */
+static int IsPristineView(List* this)
+{
+    return this->viewNodes != NULL && this->version == LIST_VIEW_VERSION;
+}
+
+/**
+ * @brief Finds the live node at a position, through the index when the list has one.
+ *
+ * @return Pointer to the node, or NULL if the position is past the end of the list.
+ */
+static Node* FindNodeAt(List* this, ListOperation operation, size_t position)
+{
+    if (position >= this->length)
+    {
+        return NULL;
+    }
+
+    if (IsPristineView(this))
+    {
+        LIST_STATS_ADD(this, operation, nodesVisited, 1);
+        return (Node*)(this->viewNodes + position * LIST_ALIGN_SIZE(sizeof(Node)));
+    }
+
+    if (this->index != NULL)
+    {
+        return ListIndexFindNode(this, operation, position);
+    }
+
+    Node* currentNode = ListSkipRemoved(this, this->head);
+    LIST_STATS_ADD(this, operation, nodesVisited, 1);
+
+    for (; position > 0; position--)
+    {
+        currentNode = ListSkipRemoved(this, currentNode->next);
+        LIST_STATS_ADD(this, operation, nodesVisited, 1);
+    }
+
+    return currentNode;
+}
+
+/**
+ * @brief Walks to the tail node.
+ *
+ * @return Pointer to the tail node, or NULL if the list is empty.
+ */
+static Node* FindTail(List* this, ListOperation operation)
+{
+    (void)operation;
+    Node* currentNode = ListSkipRemoved(this, this->head);
+
+    if (currentNode == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, operation, nodesVisited, 1);
+
+    for (Node* nextNode = ListSkipRemoved(this, currentNode->next); nextNode != NULL;
+         nextNode = ListSkipRemoved(this, nextNode->next))
+    {
+        currentNode = nextNode;
+        LIST_STATS_ADD(this, operation, nodesVisited, 1);
+    }
+
+    return currentNode;
+}
+
+/**
+ * @brief Allocates an empty list whose nodes carry payloads of dataSize bytes, 0 for header-only nodes.
+ */
+static List* CreateList(size_t dataSize)
+{
+    size_t headerSize = LIST_ALIGN_SIZE(sizeof(List));
+    size_t slotSize = LIST_ALIGN_SIZE(sizeof(Node)) + LIST_ALIGN_SIZE(dataSize);
+    size_t inlineCount = LIST_INLINE_BYTES / slotSize;
+
+    inlineCount = inlineCount < LIST_INLINE_CAPACITY ? inlineCount : LIST_INLINE_CAPACITY;
+
+    List* newList = malloc(headerSize + inlineCount * slotSize);
+
+    if (newList == NULL)
+    {
+        return NULL;
+    }
+
+    memset(newList, 0, sizeof(List));
+    newList->dataSize = (int)dataSize;
+    newList->inlineSlots = (unsigned char*)newList + headerSize;
+    newList->slotSize = slotSize;
+    newList->inlineCount = (int)inlineCount;
+    newList->inlineFree = inlineCount > 0 ? (unsigned int)((1ull << inlineCount) - 1) : 0;
+    newList->references = 1;
+
+    return newList;
+}
+
+/**
+ * @brief Constructs a new linked list instance with the specified data size.
+ *
+ * @param The dataSize of the data elements to be stored in the list.
+ * @return List pointer to the newly constructed linked list, or NULL on failure.
+ */
+List* ListConstruct(int dataSize)
+{
+    if (dataSize <= 0)
+    {
+        return NULL;
+    }
+
+    return CreateList((size_t)dataSize);
+}
+
+/**
+ * @brief Constructs a new linked list instance whose elements each have their own length.
+ *
+ * @return List pointer to the newly constructed linked list, or NULL on failure.
+ */
+List* ListConstructVariable(void)
+{
+    List* newList = CreateList(0);
+
+    if (newList == NULL)
+    {
+        return NULL;
+    }
+
+    newList->payloads = SlabArenaConstruct(LIST_SLAB_BYTES);
+
+    if (newList->payloads == NULL)
+    {
+        free(newList);
+        return NULL;
+    }
+
+    return newList;
+}
+
+/**
+ * @brief Constructs a linked list over the elements of a caller-owned array, without copying them.
+ *
+ * One block of header-only nodes is allocated and linked in array order; the
+ * nodes point into the array, which must outlive the list. Elements added
+ * later are copied into ordinary nodes as in any list.
+ *
+ * @param Base address of the array.
+ * @param Number of elements in the array.
+ * @param The dataSize of the array elements.
+ * @return List pointer to the newly constructed linked list, or NULL on failure.
+ */
+List* ListConstructView(void* base, size_t count, int dataSize)
+{
+    if (dataSize <= 0 || (base == NULL && count > 0))
+    {
+        return NULL;
+    }
+
+    List* newList = CreateList((size_t)dataSize);
+
+    if (newList == NULL || count == 0)
+    {
+        return newList;
+    }
+
+    size_t nodeSize = LIST_ALIGN_SIZE(sizeof(Node));
+
+    newList->viewNodes = malloc(count * nodeSize);
+
+    if (newList->viewNodes == NULL)
+    {
+        free(newList);
+        return NULL;
+    }
+
+    newList->viewCount = count;
+    newList->version = LIST_VIEW_VERSION;
+    Node* previousNode = NULL;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        Node* node = (Node*)(newList->viewNodes + index * nodeSize);
+
+        node->data = (unsigned char*)base + index * (size_t)dataSize;
+        node->prev = previousNode;
+        node->next = NULL;
+        node->track = NULL;
+
+        if (previousNode == NULL)
+        {
+            newList->head = node;
+        }
+        else
+        {
+            previousNode->next = node;
+        }
+
+        previousNode = node;
+    }
+
+    newList->length = count;
+
+    return newList;
+}
+
+/**
+ * @brief Destructs a linked list instance and frees all associated memory.
+ *
+ * @param Pointer to a list pointer to the linked list to be destructed.
+ * @return Error code indicating the success of the destruction operation.
+ */
+int ListDestruct(List** thisPtr)
+{
+    if (*thisPtr == NULL || thisPtr == NULL)
+    {
+        return -1;
+    }
+
+    int returnValue = ListClear(*thisPtr);
+
+    if (returnValue == -1)
+    {
+        return -1;
+    }
+
+    List* list = *thisPtr;
+    *thisPtr = NULL;
+
+    if (__atomic_sub_fetch(&list->references, 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        ListFree(list);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Frees every node, including removed ones kept for snapshots, and the list itself.
+ *
+ * @param List pointer to the linked list; no reference to it may remain.
+ */
+void ListFree(List* this)
+{
+    Node* currentNode = this->head;
+
+    __atomic_store_n(&this->head, NULL, __ATOMIC_RELEASE);
+
+    while (currentNode != NULL)
+    {
+        Node* nextNode = currentNode->next;
+        DestroyNode(this, currentNode);
+        currentNode = nextNode;
+    }
+
+    ListFreeStorage(this);
+}
+
+/**
+ * @brief Frees everything of a list whose nodes are already gone: pooled nodes
+ *        or node slabs, payload arena, view nodes, filter, index and finally the list itself.
+ *
+ * @param List pointer to the linked list; no reference to it may remain.
+ */
+void ListFreeStorage(List* this)
+{
+    while (this->pool != NULL && this->hugeSlabs == NULL)
+    {
+        Node* nextNode = this->pool->next;
+        free(this->pool);
+        this->pool = nextNode;
+    }
+
+    ListHugeFree(this);
+    SlabArenaDestruct(&this->payloads);
+    free(this->viewNodes);
+    free(this->filterCounters);
+    ListIndexFree(this);
+    ListFreeSegments(this);
+
+    if (this->rcuDomain == NULL || EpochRetire(this->rcuDomain, this, FreeRetired, NULL) == -1)
+    {
+        if (this->rcuDomain != NULL)
+        {
+            EpochSynchronize(this->rcuDomain);
+        }
+
+        free(this);
+    }
+}
+
+/**
+ * @brief Gives every node of the list a track, so that snapshots, the index
+ *        and handles can keep their history. Nodes linked before count as
+ *        added at version 0; all nodes allocated afterwards get a track too.
+ *
+ * A failure leaves some nodes tracked, which is harmless: a missing track
+ * reads as a node alive since version 0, and the next call resumes.
+ *
+ * @param List pointer to the linked list.
+ * @return Error code indicating the success of the operation.
+ */
+int ListTrackNodes(List* this)
+{
+    if (this->tracked)
+    {
+        return 0;
+    }
+
+    for (Node* currentNode = this->head; currentNode != NULL; currentNode = currentNode->next)
+    {
+        if (currentNode->track != NULL)
+        {
+            continue;
+        }
+
+        NodeTrack* track = malloc(sizeof(NodeTrack));
+
+        if (track == NULL)
+        {
+            return -1;
+        }
+
+        track->addedVersion = 0;
+        track->removedVersion = LIST_NODE_ALIVE;
+        track->indexEntry = NULL;
+        __atomic_store_n(&currentNode->track, track, __ATOMIC_RELEASE);
+    }
+
+    this->tracked = 1;
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the head data of the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @return Void pointer to the data in the head node, or NULL if the list is empty.
+ */
+void* ListGetHeadData(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_GET_HEAD_DATA);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_HEAD_DATA, calls, 1);
+
+    Node* headNode = ListSkipRemoved(this, this->head);
+
+    if (headNode == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_HEAD_DATA, nodesVisited, 1);
+    this->lastAccessed = headNode;
+
+    return headNode->data;
+}
+
+/**
+ * @brief Retrieves the data stored in the tail node of the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @return Void pointer to the data in the tail node, or NULL if the list is empty.
+ */
+void* ListGetTailData(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_GET_TAIL_DATA);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_TAIL_DATA, calls, 1);
+
+    Node* tailNode = FindTail(this, LIST_OP_GET_TAIL_DATA);
+
+    if (tailNode == NULL)
+    {
+        return NULL;
+    }
+
+    this->lastAccessed = tailNode;
+
+    return tailNode->data;
+}
+
+/**
+ * @brief Retrieves the data stored in the next node of the last accessed node.
+ *
+ * @param List pointer to the linked list.
+ * @return Void pointer to the data in the next node, or NULL if there is no next node.
+ */
+void* ListGetNextData(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_GET_NEXT_DATA);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_NEXT_DATA, calls, 1);
+
+    if (this->head == NULL || this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    this->lastAccessed = ListSkipRemoved(this, this->lastAccessed->next);
+
+    if (this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_NEXT_DATA, nodesVisited, 1);
+
+    return this->lastAccessed->data;
+}
+
+/**
+ * @brief Retrieves the data stored in the previous node of the last accessed node.
+ *
+ * @param List pointer to the linked list.
+ * @return Void pointer to the data in the previous node, or NULL if there is no previous node.
+ */
+void* ListGetPreviousData(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_GET_PREVIOUS_DATA);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_PREVIOUS_DATA, calls, 1);
+
+    if (this->head == NULL || this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    this->lastAccessed = ListSkipRemovedBackward(this, this->lastAccessed->prev);
+
+    if (this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_GET_PREVIOUS_DATA, nodesVisited, 1);
+
+    return this->lastAccessed->data;
+}
+
+/**
+ * @brief Adds a new node with the provided data to the beginning of the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @return Error code indicating the success of the operation.
+ */
+int ListAddHead(List* this, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_HEAD);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_HEAD, calls, 1);
+    PurgeRemoved(this);
+
+    if (data == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = CreateNode(this, LIST_OP_ADD_HEAD, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, NULL, newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a new node with the provided data to the end of the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @return Error code indicating the success of the operation.
+ */
+int ListAddTail(List* this, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_TAIL);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_TAIL, calls, 1);
+    PurgeRemoved(this);
+
+    if (data == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = CreateNode(this, LIST_OP_ADD_TAIL, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, FindTail(this, LIST_OP_ADD_TAIL), newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a new node with the provided data before the node containing the reference data.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @param Void pointer to the reference data.
+ * @return Error code indicating the success of the operation.
+ */
+int ListAddBefore(List* this, void* data, void* refData)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_BEFORE);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_BEFORE, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->head == NULL || data == NULL || refData == NULL)
+    {
+        return -1;
+    }
+
+    Node* refNode = FindNode(this, LIST_OP_ADD_BEFORE, refData);
+
+    if (refNode == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = CreateNode(this, LIST_OP_ADD_BEFORE, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, refNode->prev, newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a new node with the provided data after the node containing the reference data.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @param Void pointer to the reference data.
+ * @return Error code indicating the success of the operation.
+ */
+int ListAddAfter(List* this, void* data, void* refData)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_AFTER);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_AFTER, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->head == NULL || data == NULL || refData == NULL)
+    {
+        return -1;
+    }
+
+    Node* refNode = FindNode(this, LIST_OP_ADD_AFTER, refData);
+
+    if (refNode == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = CreateNode(this, LIST_OP_ADD_AFTER, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, refNode, newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a node at the beginning of the linked list, taking over the provided buffer as its data instead of copying it.
+ *
+ * @param List pointer to the linked list.
+ * @param Buffer of at least dataSize bytes allocated with malloc. It belongs to the list
+ *        once the call succeeds and is freed when its element is removed.
+ * @return Error code indicating the success of the operation; on failure the buffer stays with the caller.
+ */
+int ListAdoptHead(List* this, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADOPT_HEAD);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADOPT_HEAD, calls, 1);
+    PurgeRemoved(this);
+
+    if (data == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = AdoptNode(this, LIST_OP_ADOPT_HEAD, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, NULL, newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a node at the end of the linked list, taking over the provided buffer as its data instead of copying it.
+ *
+ * @param List pointer to the linked list.
+ * @param Buffer of at least dataSize bytes allocated with malloc. It belongs to the list
+ *        once the call succeeds and is freed when its element is removed.
+ * @return Error code indicating the success of the operation; on failure the buffer stays with the caller.
+ */
+int ListAdoptTail(List* this, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADOPT_TAIL);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADOPT_TAIL, calls, 1);
+    PurgeRemoved(this);
+
+    if (data == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = AdoptNode(this, LIST_OP_ADOPT_TAIL, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, FindTail(this, LIST_OP_ADOPT_TAIL), newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a node after the node containing the reference data, taking over the provided buffer as its data instead of copying it.
+ *
+ * @param List pointer to the linked list.
+ * @param Buffer of at least dataSize bytes allocated with malloc. It belongs to the list
+ *        once the call succeeds and is freed when its element is removed.
+ * @param Void pointer to the reference data.
+ * @return Error code indicating the success of the operation; on failure the buffer stays with the caller.
+ */
+int ListAdoptAfter(List* this, void* data, void* refData)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADOPT_AFTER);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADOPT_AFTER, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->head == NULL || data == NULL || refData == NULL)
+    {
+        return -1;
+    }
+
+    Node* refNode = FindNode(this, LIST_OP_ADOPT_AFTER, refData);
+
+    if (refNode == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = AdoptNode(this, LIST_OP_ADOPT_AFTER, data);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, refNode, newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Links a new node at the beginning of the linked list and returns its payload for the caller to fill in place.
+ *
+ * @param List pointer to the linked list.
+ * @return Pointer to the uninitialised dataSize bytes of the new element, or NULL on failure.
+ */
+void* ListEmplaceHead(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_EMPLACE_HEAD);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_EMPLACE_HEAD, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->rcuDomain != NULL || this->payloads != NULL || this->filterCounters != NULL)
+    {
+        return NULL;
+    }
+
+    Node* newNode = AllocateNode(this, LIST_OP_EMPLACE_HEAD, this->slotSize);
+
+    if (newNode == NULL)
+    {
+        return NULL;
+    }
+
+    newNode->data = (unsigned char*)newNode + LIST_ALIGN_SIZE(sizeof(Node));
+    LinkNodeAfter(this, NULL, newNode);
+
+    return newNode->data;
+}
+
+/**
+ * @brief Links a new node at the end of the linked list and returns its payload for the caller to fill in place.
+ *
+ * @param List pointer to the linked list.
+ * @return Pointer to the uninitialised dataSize bytes of the new element, or NULL on failure.
+ */
+void* ListEmplaceTail(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_EMPLACE_TAIL);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_EMPLACE_TAIL, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->rcuDomain != NULL || this->payloads != NULL || this->filterCounters != NULL)
+    {
+        return NULL;
+    }
+
+    Node* newNode = AllocateNode(this, LIST_OP_EMPLACE_TAIL, this->slotSize);
+
+    if (newNode == NULL)
+    {
+        return NULL;
+    }
+
+    newNode->data = (unsigned char*)newNode + LIST_ALIGN_SIZE(sizeof(Node));
+    LinkNodeAfter(this, FindTail(this, LIST_OP_EMPLACE_TAIL), newNode);
+
+    return newNode->data;
+}
+
+/**
+ * @brief Links a new node after the last accessed node and returns its payload for the caller to fill in place.
+ *
+ * The new node becomes the last accessed node, so repeated calls emplace a
+ * run of elements in order.
+ *
+ * @param List pointer to the linked list.
+ * @return Pointer to the uninitialised dataSize bytes of the new element, or NULL on failure.
+ */
+void* ListEmplaceAfterCursor(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_EMPLACE_AFTER_CURSOR);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_EMPLACE_AFTER_CURSOR, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->rcuDomain != NULL || this->payloads != NULL || this->filterCounters != NULL ||
+        this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    Node* newNode = AllocateNode(this, LIST_OP_EMPLACE_AFTER_CURSOR, this->slotSize);
+
+    if (newNode == NULL)
+    {
+        return NULL;
+    }
+
+    newNode->data = (unsigned char*)newNode + LIST_ALIGN_SIZE(sizeof(Node));
+    LinkNodeAfter(this, this->lastAccessed, newNode);
+    this->lastAccessed = newNode;
+
+    return newNode->data;
+}
+
+/**
+ * @brief Sets aside heap nodes so that the given number of elements can be added without allocating.
+ *
+ * Free inline slots count towards the reservation. Nodes released later refill
+ * the pool up to the reserved size.
+ *
+ * @param List pointer to the linked list.
+ * @param Number of elements to be added.
+ * @return Error code indicating the success of the operation.
+ */
+int ListReserve(List* this, size_t count)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_RESERVE);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_RESERVE, calls, 1);
+
+    size_t freeSlots = (size_t)__builtin_popcount(this->inlineFree);
+    size_t needed = count > freeSlots ? count - freeSlots : 0;
+
+    while (this->poolCount < needed)
+    {
+        Node* newNode = this->hugeSlabs != NULL ? ListHugeAllocate(this, LIST_OP_RESERVE) : malloc(this->slotSize);
+
+        if (newNode == NULL)
+        {
+            return -1;
+        }
+
+        if (this->hugeSlabs == NULL)
+        {
+            LIST_STATS_ADD(this, LIST_OP_RESERVE, allocations, 1);
+        }
+        newNode->next = this->pool;
+        this->pool = newNode;
+        this->poolCount++;
+    }
+
+    this->poolCapacity = needed > this->poolCapacity ? needed : this->poolCapacity;
+
+    return 0;
+}
+
+/**
+ * @brief Adds a copy of length bytes of data to the beginning of a variable-length list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @param Length of the data in bytes.
+ * @return Error code indicating the success of the operation.
+ */
+int ListAddHeadVariable(List* this, const void* data, size_t length)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_HEAD);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_HEAD, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->payloads == NULL || data == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = CreateVariableNode(this, LIST_OP_ADD_HEAD, data, length);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, NULL, newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Adds a copy of length bytes of data to the end of a variable-length list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @param Length of the data in bytes.
+ * @return Error code indicating the success of the operation.
+ */
+int ListAddTailVariable(List* this, const void* data, size_t length)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_TAIL);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_TAIL, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->payloads == NULL || data == NULL)
+    {
+        return -1;
+    }
+
+    Node* newNode = CreateVariableNode(this, LIST_OP_ADD_TAIL, data, length);
+
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, FindTail(this, LIST_OP_ADD_TAIL), newNode);
+
+    return 0;
+}
+
+/**
+ * @brief Removes the first element of a variable-length list equal to the reference data.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the reference data.
+ * @param Length of the reference data in bytes.
+ * @return Error code indicating the success of the operation.
+ */
+int ListRemoveVariable(List* this, const void* refData, size_t length)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_REMOVE);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_REMOVE, calls, 1);
+    PurgeRemoved(this);
+
+    if (this->payloads == NULL || this->head == NULL || refData == NULL)
+    {
+        return -1;
+    }
+
+    Node* refNode = FindVariableNode(this, LIST_OP_REMOVE, refData, length);
+
+    if (refNode == NULL)
+    {
+        return -1;
+    }
+
+    RemoveNode(this, refNode);
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the length of an element.
+ *
+ * @param List pointer to the linked list.
+ * @param Data pointer returned by one of the read functions.
+ * @return Length of the element in bytes; dataSize for fixed-size lists, 0 if an argument is NULL.
+ */
+size_t ListGetDataLength(List* this, const void* data)
+{
+    if (this == NULL || data == NULL)
+    {
+        return 0;
+    }
+
+    return this->payloads != NULL ? SlabArenaGetSize(data) : (size_t)this->dataSize;
+}
+
+/**
+ * @brief Builds the handle of a node that has just been linked.
+ */
+static ListHandle MakeHandle(Node* node)
+{
+    ListHandle handle = {node, node->track->addedVersion};
+
+    return handle;
+}
+
+/**
+ * @brief Resolves a handle to its node.
+ *
+ * The node memory of a list that issued handles is never freed before the
+ * list, so reading it is safe even for a stale handle. A node is only
+ * accepted while it is still linked at the version the handle was made at.
+ *
+ * @return Pointer to the node, or NULL if the handle is invalid or stale.
+ */
+static Node* HandleNode(List* this, ListHandle handle)
+{
+    Node* node = handle.node;
+
+    if (node == NULL || !this->handles || node->track == NULL || node->track->addedVersion != handle.generation ||
+        node->track->removedVersion != LIST_NODE_ALIVE)
+    {
+        return NULL;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Creates a node for one of the handle-returning insert functions.
+ *
+ * @return Pointer to the new node with unset links, or NULL on failure or in RCU mode.
+ */
+static Node* CreateHandledNode(List* this, ListOperation operation, const void* data)
+{
+    if (data == NULL || this->rcuDomain != NULL || ListTrackNodes(this) == -1)
+    {
+        return NULL;
+    }
+
+    this->handles = 1;
+
+    return CreateNode(this, operation, data);
+}
+
+/**
+ * @brief Adds a new node with the provided data at the beginning of the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @return Handle of the new element, or a handle with a NULL node on failure.
+ */
+ListHandle ListAddHeadH(List* this, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_HEAD);
+    ListHandle handle = {NULL, 0};
+
+    if (this == NULL)
+    {
+        return handle;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_HEAD, calls, 1);
+    PurgeRemoved(this);
+
+    Node* newNode = CreateHandledNode(this, LIST_OP_ADD_HEAD, data);
+
+    if (newNode == NULL)
+    {
+        return handle;
+    }
+
+    LinkNodeAfter(this, NULL, newNode);
+
+    return MakeHandle(newNode);
+}
+
+/**
+ * @brief Adds a new node with the provided data at the end of the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the data to be added.
+ * @return Handle of the new element, or a handle with a NULL node on failure.
+ */
+ListHandle ListAddTailH(List* this, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_TAIL);
+    ListHandle handle = {NULL, 0};
+
+    if (this == NULL)
+    {
+        return handle;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_TAIL, calls, 1);
+    PurgeRemoved(this);
+
+    Node* newNode = CreateHandledNode(this, LIST_OP_ADD_TAIL, data);
+
+    if (newNode == NULL)
+    {
+        return handle;
+    }
+
+    LinkNodeAfter(this, FindTail(this, LIST_OP_ADD_TAIL), newNode);
+
+    return MakeHandle(newNode);
+}
+
+/**
+ * @brief Adds a new node with the provided data directly after the element of a handle.
+ *
+ * @param List pointer to the linked list.
+ * @param Handle of the element to insert after.
+ * @param Void pointer to the data to be added.
+ * @return Handle of the new element, or a handle with a NULL node if the handle is stale or on failure.
+ */
+ListHandle ListInsertAfterHandle(List* this, ListHandle handle, void* data)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_ADD_AFTER);
+    ListHandle newHandle = {NULL, 0};
+
+    if (this == NULL)
+    {
+        return newHandle;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_ADD_AFTER, calls, 1);
+    PurgeRemoved(this);
+
+    Node* refNode = HandleNode(this, handle);
+
+    if (refNode == NULL)
+    {
+        return newHandle;
+    }
+
+    Node* newNode = CreateHandledNode(this, LIST_OP_ADD_AFTER, data);
+
+    if (newNode == NULL)
+    {
+        return newHandle;
+    }
+
+    LinkNodeAfter(this, refNode, newNode);
+
+    return MakeHandle(newNode);
+}
+
+/**
+ * @brief Removes the element of a handle from the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @param Handle of the element to be removed.
+ * @return Error code indicating the success of the operation; -1 if the handle is stale.
+ */
+int ListRemoveHandle(List* this, ListHandle handle)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_REMOVE);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_REMOVE, calls, 1);
+    PurgeRemoved(this);
+
+    Node* node = HandleNode(this, handle);
+
+    if (node == NULL)
+    {
+        return -1;
+    }
+
+    RemoveNode(this, node);
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the data of the element of a handle.
+ *
+ * @param List pointer to the linked list.
+ * @param Handle of the element.
+ * @return Void pointer to the data, or NULL if the handle is stale.
+ */
+void* ListGetHandleData(List* this, ListHandle handle)
+{
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    Node* node = HandleNode(this, handle);
+
+    return node != NULL ? node->data : NULL;
+}
+
+/**
+ * @brief Removes the head node from the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @return Error code indicating the success of the operation.
+ */
+int ListRemoveHead(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_REMOVE_HEAD);
+
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_REMOVE_HEAD, calls, 1);
+    PurgeRemoved(this);
+
+    Node* headNode = ListSkipRemoved(this, this->head);
+
+    if (headNode == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_REMOVE_HEAD, nodesVisited, 1);
+    RemoveNode(this, headNode);
+
+    return 0;
+}
 
 /**
- * @brief Constructs a new linked list instance with the specified data size.
+ * @brief Removes the head node and hands its data to the caller.
  *
- * @param The dataSize of the data elements to be stored in the list.
- * @return List pointer to the newly constructed linked list, or NULL on failure.
+ * Adopted buffers are returned as they are. Elements added by copy, elements
+ * of the array under a view, and elements a snapshot may still read, are
+ * copied into a new buffer.
+ *
+ * @param List pointer to the linked list.
+ * @return Buffer holding the head data, to be released with free, or NULL if the list is empty or on failure.
  */
-List* ListConstruct(int dataSize)
+void* ListDetachHead(List* this)
 {
-    if (dataSize <= 0)
+    LIST_LATENCY_SCOPE(LIST_OP_DETACH_HEAD);
+
+    if (this == NULL)
     {
         return NULL;
     }
 
-    List* newList = malloc(dataSize);
+    LIST_STATS_ADD(this, LIST_OP_DETACH_HEAD, calls, 1);
+    PurgeRemoved(this);
 
-    if (newList == NULL)
+    Node* headNode = ListSkipRemoved(this, this->head);
+
+    if (headNode == NULL || this->payloads != NULL)
     {
         return NULL;
     }
 
-    newList->head = NULL;
-    newList->lastAccessed = NULL;
-    newList->dataSize = dataSize;
+    LIST_STATS_ADD(this, LIST_OP_DETACH_HEAD, nodesVisited, 1);
+    void* data;
 
-    return newList;
+    if (ListIsAdoptedNode(headNode) && !ListIsViewNode(this, headNode) && !HasSnapshots(this))
+    {
+        if (this->filterCounters != NULL)
+        {
+            ListFilterErase(this, headNode->data);
+        }
+
+        data = headNode->data;
+        /* DestroyNode frees the payload of an adopted node; free(NULL) leaves the buffer alone. */
+        headNode->data = NULL;
+    }
+    else
+    {
+        data = malloc(this->dataSize);
+
+        if (data == NULL)
+        {
+            return NULL;
+        }
+
+        LIST_STATS_ADD(this, LIST_OP_DETACH_HEAD, allocations, 1);
+        LIST_STATS_ADD(this, LIST_OP_DETACH_HEAD, bytesCopied, this->dataSize);
+        memcpy(data, headNode->data, this->dataSize);
+    }
+
+    RemoveNode(this, headNode);
+
+    return data;
 }
 
 /**
- * @brief Destructs a linked list instance and frees all associated memory.
+ * @brief Retrieves the data at a position and moves the cursor there.
  *
- * @param Pointer to a list pointer to the linked list to be destructed.
- * @return Error code indicating the success of the destruction operation.
+ * ListGetNextData and ListGetPreviousData continue from that element.
+ *
+ * @param List pointer to the linked list.
+ * @param Zero-based position of the element.
+ * @return Void pointer to the data, or NULL if the position is past the end of the list.
  */
-int ListDestruct(List** thisPtr)
+void* ListGetAt(List* this, size_t position)
 {
-    if (*thisPtr == NULL || thisPtr == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_GET_AT);
+
+    if (this == NULL)
     {
-        return -1;
+        return NULL;
     }
 
-    int returnValue = ListClear(*thisPtr);
+    LIST_STATS_ADD(this, LIST_OP_GET_AT, calls, 1);
 
-    if (returnValue == -1)
+    Node* node = FindNodeAt(this, LIST_OP_GET_AT, position);
+
+    if (node == NULL)
     {
-        return -1;
+        return NULL;
     }
 
-    free(*thisPtr);
-    *thisPtr = NULL;
+    this->lastAccessed = node;
 
-    return 0;
+    return node->data;
 }
 
 /**
- * @brief Retrieves the head data of the linked list.
+ * @brief Adds a new node with the provided data so that it ends up at the given position.
  *
  * @param List pointer to the linked list.
- * @return Void pointer to the data in the head node, or NULL if the list is empty.
+ * @param Zero-based position of the new element, at most the length of the list.
+ * @param Void pointer to the data to be added.
+ * @return Error code indicating the success of the operation.
  */
-void* ListGetHeadData(List* this)
+int ListInsertAt(List* this, size_t position, void* data)
 {
-    if (this == NULL || this->head == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_INSERT_AT);
+
+    if (this == NULL)
     {
-        return NULL;
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_INSERT_AT, calls, 1);
+    PurgeRemoved(this);
+
+    if (data == NULL || position > this->length)
+    {
+        return -1;
     }
 
-    this->lastAccessed = this->head;
+    Node* previousNode = position > 0 ? FindNodeAt(this, LIST_OP_INSERT_AT, position - 1) : NULL;
+    Node* newNode = CreateNode(this, LIST_OP_INSERT_AT, data);
 
-    return this->head->data;
+    if (newNode == NULL)
+    {
+        return -1;
+    }
+
+    LinkNodeAfter(this, previousNode, newNode);
+
+    return 0;
 }
 
 /**
- * @brief Retrieves the data stored in the tail node of the linked list.
+ * @brief Removes the node at a position from the linked list.
  *
  * @param List pointer to the linked list.
- * @return Void pointer to the data in the tail node, or NULL if the list is empty.
+ * @param Zero-based position of the element.
+ * @return Error code indicating the success of the operation.
  */
-void* ListGetTailData(List* this)
+int ListRemoveAt(List* this, size_t position)
 {
-    if (this == NULL || this->head == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_REMOVE_AT);
+
+    if (this == NULL)
     {
-        return NULL;
+        return -1;
     }
 
-    Node* currentNode = this->head;
+    LIST_STATS_ADD(this, LIST_OP_REMOVE_AT, calls, 1);
+    PurgeRemoved(this);
+
+    Node* node = FindNodeAt(this, LIST_OP_REMOVE_AT, position);
 
-    while (currentNode->next != NULL)
+    if (node == NULL)
     {
-        currentNode = currentNode->next;
+        return -1;
     }
 
-    this->lastAccessed = currentNode;
+    RemoveNode(this, node);
 
-    return currentNode->data;
+    return 0;
 }
 
 /**
- * @brief Retrieves the data stored in the next node of the last accessed node.
+ * @brief Moves a live node to the position after previousNode, or to the head when previousNode is NULL.
  *
- * @param List pointer to the linked list.
- * @return Void pointer to the data in the next node, or NULL if there is no next node.
+ * The node keeps its payload and its link version, so handles to it stay valid.
  */
-void* ListGetNextData(List* this)
+static void MoveNodeAfter(List* this, Node* previousNode, Node* node)
 {
-    if (this == NULL || this->head == NULL || this->lastAccessed == NULL)
+    if (this->index != NULL)
     {
-        return NULL;
+        ListIndexErase(this, node);
     }
 
-    this->lastAccessed = this->lastAccessed->next;
+    UnlinkNode(this, node);
+    SpliceNodeAfter(this, previousNode, node);
+    this->version++;
 
-    if (this->lastAccessed == NULL)
+    if (this->index != NULL)
     {
-        return NULL;
+        ListIndexInsert(this, node);
     }
-
-    return this->lastAccessed->data;
 }
 
 /**
- * @brief Retrieves the data stored in the previous node of the last accessed node.
+ * @brief Finds the element to be moved. Moving is refused while snapshots or RCU readers could be walking the list.
  *
- * @param List pointer to the linked list.
- * @return Void pointer to the data in the previous node, or NULL if there is no previous node.
+ * @return Pointer to the node, or NULL if there is none or it cannot be moved.
  */
-void* ListGetPreviousData(List* this)
+static Node* FindMovableNode(List* this, ListOperation operation, const void* refData)
 {
-    if (this == NULL || this->head == NULL || this->lastAccessed == NULL)
-    {
-        return NULL;
-    }
+    PurgeRemoved(this);
 
-    this->lastAccessed = this->lastAccessed->prev;
-
-    if (this->lastAccessed == NULL)
+    if (this->head == NULL || refData == NULL || this->rcuDomain != NULL || HasSnapshots(this))
     {
         return NULL;
     }
 
-    return this->lastAccessed->data;
+    return FindNode(this, operation, refData);
 }
 
 /**
- * @brief Adds a new node with the provided data to the beginning of the linked list.
+ * @brief Moves the first element equal to the reference data to the head of the list, without copying it.
  *
  * @param List pointer to the linked list.
- * @param Void pointer to the data to be added.
+ * @param Void pointer to the reference data.
  * @return Error code indicating the success of the operation.
  */
-int ListAddHead(List* this, void* data)
+int ListMoveToHead(List* this, void* refData)
 {
-    if (this == NULL || data == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_MOVE_TO_HEAD);
+
+    if (this == NULL)
     {
         return -1;
     }
 
-    Node* newNode = malloc(sizeof(Node));
-    newNode->data = malloc(this->dataSize);
+    LIST_STATS_ADD(this, LIST_OP_MOVE_TO_HEAD, calls, 1);
 
-    if (newNode == NULL || newNode->data == NULL)
+    Node* node = FindMovableNode(this, LIST_OP_MOVE_TO_HEAD, refData);
+
+    if (node == NULL)
     {
         return -1;
     }
 
-    memcpy(newNode->data, data, this->dataSize);
-    newNode->prev = NULL;
-    newNode->next = this->head;
-    this->head = newNode;
-
-    if (newNode->next != NULL)
+    if (node != this->head)
     {
-        newNode->next->prev = newNode;
+        MoveNodeAfter(this, NULL, node);
     }
 
     return 0;
 }
 
 /**
- * @brief Adds a new node with the provided data to the end of the linked list.
+ * @brief Moves the first element equal to the reference data to the tail of the list, without copying it.
  *
  * @param List pointer to the linked list.
- * @param Void pointer to the data to be added.
+ * @param Void pointer to the reference data.
  * @return Error code indicating the success of the operation.
  */
-int ListAddTail(List* this, void* data)
+int ListMoveToTail(List* this, void* refData)
 {
-    if (this == NULL || data == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_MOVE_TO_TAIL);
+
+    if (this == NULL)
     {
         return -1;
     }
 
-    Node* newNode = malloc(sizeof(Node));
-    newNode->data = malloc(this->dataSize);
+    LIST_STATS_ADD(this, LIST_OP_MOVE_TO_TAIL, calls, 1);
 
-    if (newNode == NULL || newNode->data == NULL)
+    Node* node = FindMovableNode(this, LIST_OP_MOVE_TO_TAIL, refData);
+
+    if (node == NULL)
     {
         return -1;
     }
 
-    memcpy(newNode->data, data, this->dataSize);
-    newNode->prev = NULL;
-    newNode->next = NULL;
+    Node* tailNode = node;
 
-    Node* currentNode = this->head;
-    if (currentNode == NULL)
+    while (tailNode->next != NULL)
     {
-        this->head = newNode;
-        return 0;
+        tailNode = tailNode->next;
+        LIST_STATS_ADD(this, LIST_OP_MOVE_TO_TAIL, nodesVisited, 1);
     }
 
-    while (currentNode->next != NULL)
+    if (tailNode != node)
     {
-        currentNode = currentNode->next;
+        MoveNodeAfter(this, tailNode, node);
     }
 
-    currentNode->next = newNode;
-    newNode->prev = currentNode;
-
     return 0;
 }
 
 /**
- * @brief Adds a new node with the provided data before the node containing the reference data.
+ * @brief Removes the tail node from the linked list.
  *
  * @param List pointer to the linked list.
- * @param Void pointer to the data to be added.
- * @param Void pointer to the reference data.
  * @return Error code indicating the success of the operation.
  */
-int ListAddBefore(List* this, void* data, void* refData)
+int ListRemoveTail(List* this)
 {
-    if (this == NULL || this->head == NULL || data == NULL || refData == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_REMOVE_TAIL);
+
+    if (this == NULL)
     {
         return -1;
     }
 
-    Node* currentNode = this->head;
-    Node* previousNode = NULL;
+    LIST_STATS_ADD(this, LIST_OP_REMOVE_TAIL, calls, 1);
+    PurgeRemoved(this);
 
-    while (currentNode->next != NULL && memcmp(currentNode->data, refData, this->dataSize) != 0)
+    Node* tailNode = FindTail(this, LIST_OP_REMOVE_TAIL);
+
+    if (tailNode == NULL)
     {
-        previousNode = currentNode;
-        currentNode = currentNode->next;
+        return -1;
     }
 
-    if (currentNode->next == NULL && memcmp(currentNode->data, refData, this->dataSize) != 0)
+    RemoveNode(this, tailNode);
+
+    return 0;
+}
+
+/**
+ * @brief Removes the first node containing the reference data from the linked list.
+ *
+ * @param List pointer to the linked list.
+ * @param Void pointer to the reference data.
+ * @return Error code indicating the success of the operation.
+ */
+int ListRemove(List* this, void* refData)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_REMOVE);
+
+    if (this == NULL)
     {
         return -1;
     }
 
-    Node* newNode = malloc(sizeof(Node));
-    newNode->data = malloc(this->dataSize);
+    LIST_STATS_ADD(this, LIST_OP_REMOVE, calls, 1);
+    PurgeRemoved(this);
 
-    if (newNode == NULL || newNode->data == NULL)
+    if (this->head == NULL || refData == NULL)
     {
         return -1;
     }
 
-    memcpy(newNode->data, data, this->dataSize);
-    newNode->prev = NULL;
+    Node* refNode = FindNode(this, LIST_OP_REMOVE, refData);
 
-    newNode->next = currentNode;
-    if (previousNode == NULL)
+    if (refNode == NULL)
     {
-        this->head = newNode;
-        return 0;
+        return -1;
     }
 
-    previousNode->next = newNode;
-    newNode->prev = previousNode;
-    currentNode->prev = newNode;
-    
+    RemoveNode(this, refNode);
+
     return 0;
 }
 
 /**
- * @brief Adds a new node with the provided data after the node containing the reference data.
+ * @brief Clears all nodes and associated memory from the linked list, leaving an empty list.
  *
  * @param List pointer to the linked list.
- * @param Void pointer to the data to be added.
- * @param Void pointer to the reference data.
  * @return Error code indicating the success of the operation.
  */
-int ListAddAfter(List* this, void* data, void* refData)
+int ListClear(List* this)
 {
-    if (this == NULL || this->head == NULL || data == NULL || refData == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_CLEAR);
+
+    if (this == NULL)
     {
         return -1;
     }
 
-    Node* currentNode = this->head;
-    Node* previousNode = currentNode;
+    LIST_STATS_ADD(this, LIST_OP_CLEAR, calls, 1);
+    PurgeRemoved(this);
+    this->version++;
 
-    while (currentNode != NULL && memcmp(previousNode->data, refData, this->dataSize) != 0)
+    if (this->filterCounters != NULL)
     {
-        previousNode = currentNode;
-        currentNode = currentNode->next;
+        ListFilterReset(this);
     }
 
-    if (currentNode == NULL && memcmp(previousNode->data, refData, this->dataSize) != 0)
+    if (this->index != NULL)
     {
-        return -1;
+        ListIndexReset(this);
     }
 
-    Node* copyNode = NULL;
-    Node* newNode = malloc(sizeof(Node));
-    newNode->data = malloc(this->dataSize);
-
-    if (newNode == NULL || newNode->data == NULL)
+    if (HasSnapshots(this))
     {
-        return -1;
+        for (Node* currentNode = ListSkipRemoved(this, this->head); currentNode != NULL;
+             currentNode = ListSkipRemoved(this, currentNode->next))
+        {
+            __atomic_store_n(&currentNode->track->removedVersion, this->version, __ATOMIC_RELAXED);
+            this->removedCount++;
+            LIST_STATS_ADD(this, LIST_OP_CLEAR, nodesVisited, 1);
+        }
+
+        this->lastAccessed = NULL;
+        this->length = 0;
+
+        return 0;
     }
 
-    memcpy(newNode->data, data, this->dataSize);
+    Node* currentNode = this->head;
 
-    copyNode = previousNode->next;
-    previousNode->next = newNode;
-    newNode->next = copyNode;
-    newNode->prev = previousNode;
+    __atomic_store_n(&this->head, NULL, __ATOMIC_RELEASE);
 
-    if (copyNode != NULL)
+    while (currentNode != NULL)
     {
-        copyNode->prev = newNode;
+        Node* temp = currentNode->next;
+
+        DestroyNode(this, currentNode);
+        LIST_STATS_ADD(this, LIST_OP_CLEAR, nodesVisited, 1);
+
+        currentNode = temp;
     }
 
+    this->lastAccessed = NULL;
+    this->length = 0;
+
     return 0;
 }
 
 /**
- * @brief Removes the head node from the linked list.
+ * @brief Retrieves the number of elements in the linked list.
  *
  * @param List pointer to the linked list.
- * @return Error code indicating the success of the operation.
+ * @return The number of elements, or 0 if the list is NULL.
  */
-int ListRemoveHead(List* this)
+size_t ListGetLength(List* this)
 {
-    if (this == NULL || this->head == NULL)
+    if (this == NULL)
     {
-        return -1;
+        return 0;
     }
 
-    Node* currentNode = this->head;
-    Node* temp = currentNode->next;
+    return this->length;
+}
+
+/**
+ * @brief Copies the payloads of up to max live nodes, starting at node, into a contiguous buffer.
+ *
+ * Payloads that lie back to back in memory, as the elements of a view do,
+ * are copied with one memcpy per run; an untouched view is copied straight
+ * from its array without walking the nodes. The node after the current run
+ * is prefetched while the run is copied.
+ *
+ * @return Number of elements copied.
+ */
+static size_t GatherData(List* this, ListOperation operation, Node* node, unsigned char* destination, size_t max)
+{
+    (void)operation;
+    size_t dataSize = (size_t)this->dataSize;
+    size_t copied = 0;
 
-    free(currentNode->data);
-    free(currentNode);
+    if (node != NULL && max > 0 && IsPristineView(this))
+    {
+        size_t first = (size_t)((unsigned char*)node - this->viewNodes) / LIST_ALIGN_SIZE(sizeof(Node));
 
-    this->head = temp;
+        copied = this->viewCount - first < max ? this->viewCount - first : max;
+        memcpy(destination, node->data, copied * dataSize);
+        node = NULL;
+    }
 
-    if (temp != NULL)
+    while (node != NULL && copied < max)
     {
-        temp->prev = NULL;
+        const unsigned char* runStart = node->data;
+        size_t runLength = 1;
+        Node* nextNode = ListSkipRemoved(this, node->next);
+
+        while (nextNode != NULL && copied + runLength < max &&
+               (const unsigned char*)nextNode->data == runStart + runLength * dataSize)
+        {
+            runLength++;
+            nextNode = ListSkipRemoved(this, nextNode->next);
+        }
+
+        if (nextNode != NULL)
+        {
+            __builtin_prefetch(nextNode->data);
+            __builtin_prefetch(nextNode->next);
+        }
+
+        memcpy(destination + copied * dataSize, runStart, runLength * dataSize);
+        copied += runLength;
+        node = nextNode;
     }
 
-    return 0;
+    LIST_STATS_ADD(this, operation, nodesVisited, copied);
+    LIST_STATS_ADD(this, operation, bytesCopied, copied * dataSize);
+
+    return copied;
 }
 
 /**
- * @brief Removes the tail node from the linked list.
+ * @brief Copies every element into a new contiguous array, in list order.
  *
  * @param List pointer to the linked list.
- * @return Error code indicating the success of the operation.
+ * @param Receives the number of elements in the array; may be NULL.
+ * @return Array to be released with free, or NULL if the list is empty, variable-length or on failure.
  */
-int ListRemoveTail(List* this)
+void* ListToArray(List* this, size_t* count)
 {
-    if (this == NULL || this->head == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_TO_ARRAY);
+
+    if (count != NULL)
     {
-        return -1;
+        *count = 0;
     }
 
-    Node* currentNode = this->head;
-    Node* previousNode = NULL;
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_TO_ARRAY, calls, 1);
+
+    if (this->length == 0 || this->payloads != NULL)
+    {
+        return NULL;
+    }
+
+    unsigned char* array = malloc(this->length * (size_t)this->dataSize);
 
-    while (currentNode->next != NULL)
+    if (array == NULL)
     {
-        previousNode = currentNode;
-        currentNode = currentNode->next;
+        return NULL;
     }
 
-    free(currentNode->data);
-    free(currentNode);
+    LIST_STATS_ADD(this, LIST_OP_TO_ARRAY, allocations, 1);
+    size_t copied = GatherData(this, LIST_OP_TO_ARRAY, ListSkipRemoved(this, this->head), array, this->length);
 
-    if (previousNode == NULL)
+    if (count != NULL)
     {
-        this->head = NULL;
-        return 0;
+        *count = copied;
     }
-    previousNode->next = NULL;
 
-    return 0;
+    return array;
 }
 
 /**
- * @brief Removes the first node containing the reference data from the linked list.
+ * @brief Copies the elements from the head on into a caller-provided buffer, in list order.
  *
  * @param List pointer to the linked list.
- * @param Void pointer to the reference data.
- * @return Error code indicating the success of the operation.
+ * @param Buffer with room for max elements.
+ * @param Maximum number of elements to copy.
+ * @return Number of elements copied; 0 for a NULL argument or a variable-length list.
  */
-int ListRemove(List* this, void* refData)
+size_t ListCopyInto(List* this, void* destination, size_t max)
 {
-    if (this == NULL || this->head == NULL || refData == NULL)
+    LIST_LATENCY_SCOPE(LIST_OP_COPY_INTO);
+
+    if (this == NULL)
     {
-        return -1;
+        return 0;
     }
 
-    Node* currentNode = this->head;
-    Node* previousNode = NULL;
-    Node* temp = NULL;
+    LIST_STATS_ADD(this, LIST_OP_COPY_INTO, calls, 1);
 
-    while (currentNode != NULL && memcmp(currentNode->data, refData, this->dataSize) != 0)
+    if (destination == NULL || this->payloads != NULL)
     {
-        previousNode = currentNode;
-        currentNode = currentNode->next;
+        return 0;
     }
 
-    if (currentNode == NULL)
-    {
-        return -1;
-    }
+    return GatherData(this, LIST_OP_COPY_INTO, ListSkipRemoved(this, this->head), destination, max);
+}
 
-    if (currentNode == this->lastAccessed)
+/**
+ * @brief Copies up to count elements, starting at a position, into a caller-provided buffer.
+ *
+ * The first element is found through the positional index when it is enabled.
+ *
+ * @param List pointer to the linked list.
+ * @param Zero-based position of the first element to copy.
+ * @param Maximum number of elements to copy.
+ * @param Buffer with room for count elements.
+ * @return Number of elements copied, fewer than count when the list ends first.
+ */
+size_t ListCopyRangeInto(List* this, size_t position, size_t count, void* destination)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_COPY_RANGE_INTO);
+
+    if (this == NULL)
     {
-        this->lastAccessed = NULL;
+        return 0;
     }
 
-    temp = currentNode->next;
-    free(currentNode->data);
-    free(currentNode);
+    LIST_STATS_ADD(this, LIST_OP_COPY_RANGE_INTO, calls, 1);
 
-    if (previousNode == NULL)
-    {
-        this->head = temp;
-    }
-    else
+    if (destination == NULL || this->payloads != NULL || count == 0)
     {
-        previousNode->next = temp;
+        return 0;
     }
 
-    if (temp != NULL)
+    Node* node = FindNodeAt(this, LIST_OP_COPY_RANGE_INTO, position);
+
+    return GatherData(this, LIST_OP_COPY_RANGE_INTO, node, destination, count);
+}
+
+/**
+ * @brief Copies the operation statistics of the linked list.
+ *
+ * Counters are only maintained when the library is built with -DLIST_STATS;
+ * otherwise the copied statistics are all zero.
+ *
+ * @param List pointer to the linked list.
+ * @param Pointer to the statistics structure to be filled.
+ * @return Error code indicating the success of the operation.
+ */
+int ListGetStats(List* this, ListStats* stats)
+{
+    if (this == NULL || stats == NULL)
     {
-        temp->prev = previousNode;
+        return -1;
     }
 
+#ifdef LIST_STATS
+    *stats = this->stats;
+    unsigned long long misses = stats->filterRejections + stats->filterFalsePositives;
+    stats->filterFalsePositiveRate = misses > 0 ? (double)stats->filterFalsePositives / (double)misses : 0.0;
+#else
+    memset(stats, 0, sizeof(ListStats));
+#endif
+
     return 0;
 }
 
 /**
- * @brief Clears all nodes and associated memory from the linked list, leaving an empty list.
+ * @brief Resets all operation statistics of the linked list to zero.
  *
  * @param List pointer to the linked list.
  * @return Error code indicating the success of the operation.
  */
-int ListClear(List* this)
+int ListResetStats(List* this)
 {
     if (this == NULL)
     {
         return -1;
     }
 
-    while (this->head != NULL)
-    {
-        ListRemoveHead(this);
-    }
+#ifdef LIST_STATS
+    memset(&this->stats, 0, sizeof(ListStats));
+#endif
 
     return 0;
-}
\ No newline at end of file
+}
@@ -4,6 +4,20 @@
  * @brief Generic doubly linked list implementation
  * @version 0.1 2023-08-10 Initial version
  * @version 0.2 2023-08-18 Finalised unit tests
+ * @version 0.3 2026-10-19 Optional operation statistics (LIST_STATS)
+ * @version 0.4 2026-10-19 ListGetLength, parallel for-each and reduce
+ * @version 0.5 2026-10-19 Read-only snapshots
+ * @version 0.6 2026-10-19 RCU mode with lock-free readers
+ * @version 0.7 2026-10-19 Ownership transfer: ListAdopt* and ListDetachHead
+ * @version 0.8 2026-10-19 In-place construction: ListEmplace* and ListReserve
+ * @version 0.9 2026-10-19 Variable-length lists
+ * @version 0.10 2026-10-19 Bloom filter for searches by value
+ * @version 0.11 2026-10-19 Positional access: ListGetAt, ListInsertAt, ListRemoveAt
+ * @version 0.12 2026-10-19 Node handles: ListAdd*H, ListInsertAfterHandle, ListRemoveHandle
+ * @version 0.13 2026-10-19 Background reclamation: ListClearAsync, ListDestructAsync
+ * @version 0.14 2026-10-19 Huge-page backed node slabs: ListEnableHugePages
+ * @version 0.15 2026-10-19 Views over caller-owned arrays: ListConstructView, ListMoveToHead, ListMoveToTail
+ * @version 0.16 2026-10-19 Export to arrays: ListToArray, ListCopyInto, ListCopyRangeInto
  * @date 2023-08-18
  * 
  * @copyright Copyright (c) 2023
@@ -15,12 +29,136 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "epoch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 typedef struct list List;
+typedef struct list_snapshot ListSnapshotHandle;
+
+/**
+ * Names one element of one list for as long as it stays in that list. The
+ * fields are private; a handle whose node is NULL is the failure value.
+ */
+typedef struct list_handle ListHandle;
+struct list_handle
+{
+    void* node;
+    unsigned long generation;
+};
+
+/**
+ * Operations tracked by the statistics API. Every public list function
+ * accounts its work under exactly one of these entries.
+ */
+typedef enum
+{
+    LIST_OP_GET_HEAD_DATA,
+    LIST_OP_GET_TAIL_DATA,
+    LIST_OP_GET_NEXT_DATA,
+    LIST_OP_GET_PREVIOUS_DATA,
+    LIST_OP_ADD_HEAD,
+    LIST_OP_ADD_TAIL,
+    LIST_OP_ADD_BEFORE,
+    LIST_OP_ADD_AFTER,
+    LIST_OP_REMOVE_HEAD,
+    LIST_OP_REMOVE_TAIL,
+    LIST_OP_REMOVE,
+    LIST_OP_CLEAR,
+    LIST_OP_FOR_EACH_PARALLEL,
+    LIST_OP_REDUCE_PARALLEL,
+    LIST_OP_SNAPSHOT,
+    LIST_OP_ADOPT_HEAD,
+    LIST_OP_ADOPT_TAIL,
+    LIST_OP_ADOPT_AFTER,
+    LIST_OP_DETACH_HEAD,
+    LIST_OP_EMPLACE_HEAD,
+    LIST_OP_EMPLACE_TAIL,
+    LIST_OP_EMPLACE_AFTER_CURSOR,
+    LIST_OP_RESERVE,
+    LIST_OP_GET_AT,
+    LIST_OP_INSERT_AT,
+    LIST_OP_REMOVE_AT,
+    LIST_OP_MOVE_TO_HEAD,
+    LIST_OP_MOVE_TO_TAIL,
+    LIST_OP_TO_ARRAY,
+    LIST_OP_COPY_INTO,
+    LIST_OP_COPY_RANGE_INTO,
+    LIST_OP_COUNT
+} ListOperation;
+
+/**
+ * Callbacks of the parallel scans. They run concurrently on several threads
+ * and may modify the element they are given, but must not add or remove
+ * elements of the list being scanned.
+ */
+typedef void (*ListVisitFunction)(void* data, void* context);
+typedef void (*ListReduceFunction)(void* accumulator, const void* data, void* context);
+typedef void (*ListCombineFunction)(void* accumulator, const void* partial, void* context);
+
+typedef struct list_op_stats ListOpStats;
+struct list_op_stats
+{
+    unsigned long long calls;
+    unsigned long long nodesVisited;
+    unsigned long long compareCalls;
+    unsigned long long bytesCopied;
+    unsigned long long allocations;
+};
+
+/**
+ * Counters are only maintained when the library is built with -DLIST_STATS.
+ * In the normal build they are compiled out and always read as zero.
+ * The filter counters cover the searches by value that found nothing while
+ * the Bloom filter was enabled: filterRejections were answered by the
+ * filter alone, filterFalsePositives walked the list in vain.
+ * filterFalsePositiveRate is the share of the latter, computed by
+ * ListGetStats.
+ */
+typedef struct list_stats ListStats;
+struct list_stats
+{
+    ListOpStats op[LIST_OP_COUNT];
+    unsigned long long filterRejections;
+    unsigned long long filterFalsePositives;
+    double filterFalsePositiveRate;
+};
 
 List* ListConstruct(int dataSize);
 int ListDestruct(List**);
 
+/**
+ * A view is a list over the count elements of a caller-owned array: the
+ * list allocates only the links, and its data pointers point into the
+ * array, so the array must outlive the list and element changes through
+ * either are seen by both. All list functions work on a view. Elements
+ * added later are copied into ordinary list nodes, and removing an element
+ * of the array only unlinks it; the array itself is never modified or freed.
+ * ListMoveToHead and ListMoveToTail reorder any list without copying
+ * payloads; they fail while snapshots are alive and in RCU mode.
+ */
+List* ListConstructView(void* base, size_t count, int dataSize);
+int ListMoveToHead(List*, void* refData);
+int ListMoveToTail(List*, void* refData);
+
+/**
+ * A variable-length list stores every element with its own length, packed
+ * in shared slabs. It is filled with ListAddHeadVariable and
+ * ListAddTailVariable and searched with ListRemoveVariable; the read and
+ * remove functions without a data argument work as for any list, and
+ * ListGetDataLength tells the length of an element. The functions that take
+ * fixed-size data, ListDetachHead and RCU mode fail on such a list. The
+ * variable functions account their work under the matching fixed-size
+ * operation in the statistics.
+ */
+List* ListConstructVariable(void);
+int ListAddHeadVariable(List*, const void* data, size_t length);
+int ListAddTailVariable(List*, const void* data, size_t length);
+int ListRemoveVariable(List*, const void* refData, size_t length);
+size_t ListGetDataLength(List*, const void* data);
+
 void* ListGetHeadData(List*);
 void* ListGetTailData(List*);
 void* ListGetNextData(List*);
@@ -31,9 +169,159 @@ int ListAddTail(List*, void* data);
 int ListAddBefore(List*, void* data, void* refData);
 int ListAddAfter(List*, void* data, void* refData);
 
+/**
+ * The adopt functions take a malloc'ed buffer of at least dataSize bytes as
+ * the element itself instead of copying it; on success the list owns the
+ * buffer. ListDetachHead removes the head element and returns its data as a
+ * buffer the caller must free, handing adopted buffers back without a copy.
+ */
+int ListAdoptHead(List*, void* data);
+int ListAdoptTail(List*, void* data);
+int ListAdoptAfter(List*, void* data, void* refData);
+void* ListDetachHead(List*);
+
+/**
+ * The emplace functions link a new element and return its uninitialised
+ * payload, so the caller constructs the element directly in list storage.
+ * It must be written before any other list function is called. After
+ * ListReserve(list, n), the next n emplaced or added elements allocate
+ * nothing. Emplacing is not available in RCU mode, where readers would
+ * see the element before it is written, nor while the Bloom filter is
+ * enabled, which hashes the element when it is linked.
+ */
+void* ListEmplaceHead(List*);
+void* ListEmplaceTail(List*);
+void* ListEmplaceAfterCursor(List*);
+int ListReserve(List*, size_t count);
+
+/**
+ * ListEnableHugePages makes an empty list carve its heap nodes from 2 MiB
+ * slabs backed by huge pages where the system provides them: reserved huge
+ * pages if there are any, transparent huge pages otherwise. Traversals of
+ * large lists then need far fewer TLB entries. No privileges are needed;
+ * without huge pages the slabs behave like ordinary memory. Released nodes
+ * are kept for reuse and the slabs are only returned with the list, so the
+ * list never shrinks. It cannot be combined with RCU mode, and
+ * ListClearAsync and ListDestructAsync free such a list synchronously.
+ */
+int ListEnableHugePages(List*);
+
+/**
+ * ListEnableFilter puts a counting Bloom filter sized for expectedCount
+ * elements in front of ListAddBefore, ListAddAfter, ListAdoptAfter,
+ * ListRemove and ListRemoveVariable, so that most searches for a missing
+ * value fail in constant time. The filter hashes the element bytes when an
+ * element is added or removed, so elements must not be modified in place
+ * while it is enabled. It grows with the list and lasts as long as the list.
+ */
+int ListEnableFilter(List*, size_t expectedCount);
+
+/**
+ * Positions count the elements from the head, starting at 0. The positional
+ * functions walk the list unless ListEnableIndex has built an
+ * order-statistic index over it, which makes them O(log n) for an extra
+ * allocation per element. The index is kept up to date by every function
+ * that adds or removes elements and lasts as long as the list; should
+ * maintaining it fail for lack of memory, it is dropped and the positional
+ * functions walk again.
+ */
+int ListEnableIndex(List*);
+void* ListGetAt(List*, size_t position);
+int ListInsertAt(List*, size_t position, void* data);
+int ListRemoveAt(List*, size_t position);
+
+/**
+ * The H variants of the add functions return a handle to the new element.
+ * ListInsertAfterHandle, ListRemoveHandle and ListGetHandleData then reach
+ * that element in O(1) instead of searching for it. Once the element has
+ * left the list, by any function, its handle is stale: every handle
+ * function detects that and fails, even after the memory has been reused
+ * for another element. Handles must only be used with the list that issued
+ * them and not after it has been destructed. A list that has issued handles
+ * keeps its released nodes for reuse until it is destructed and cannot be
+ * switched to RCU mode; handles are not available in RCU mode. The handle
+ * functions account their work under the matching operation in the
+ * statistics.
+ */
+ListHandle ListAddHeadH(List*, void* data);
+ListHandle ListAddTailH(List*, void* data);
+ListHandle ListInsertAfterHandle(List*, ListHandle handle, void* data);
+int ListRemoveHandle(List*, ListHandle handle);
+void* ListGetHandleData(List*, ListHandle handle);
+
 int ListRemoveHead(List*);
 int ListRemoveTail(List*);
 int ListRemove(List*, void* refData);
 int ListClear(List*);
 
+/**
+ * ListClearAsync and ListDestructAsync detach the nodes in constant time and
+ * leave freeing them to a background reclaimer thread, which frees a batch
+ * of nodes at a time with a pause after each (see ListReclaimerConfigure);
+ * ListReclaimerDrain waits until it has caught up. Views and lists in RCU
+ * mode, with live snapshots or with huge-page node slabs fall back to the
+ * synchronous functions, and so does ListClearAsync for variable-length
+ * lists and for lists with an index or issued handles. Nodes reserved with
+ * ListReserve are not kept by ListClearAsync.
+ */
+int ListClearAsync(List*);
+int ListDestructAsync(List**);
+int ListReclaimerConfigure(size_t batchSize, unsigned long pauseMicroseconds);
+void ListReclaimerDrain(void);
+
+size_t ListGetLength(List*);
+
+/**
+ * The export functions copy elements, in list order, into one contiguous
+ * array for code that wants plain arrays: ListToArray into a new array the
+ * caller frees, ListCopyInto into a caller buffer from the head on, and
+ * ListCopyRangeInto from a position on. They do not move the cursor. Runs of
+ * elements that are contiguous in memory, such as the untouched elements of
+ * a view, are copied with one memcpy each. Variable-length lists cannot be
+ * exported.
+ */
+void* ListToArray(List*, size_t* count);
+size_t ListCopyInto(List*, void* destination, size_t max);
+size_t ListCopyRangeInto(List*, size_t position, size_t count, void* destination);
+
+int ListForEachParallel(List*, ListVisitFunction visit, void* context, int threadCount);
+int ListReduceParallel(List*, ListReduceFunction reduce, ListCombineFunction combine,
+                       void* result, size_t resultSize, void* context, int threadCount);
+
+/**
+ * A snapshot is a read-only view of the list as it was when ListSnapshot was
+ * called. ListSnapshot must be serialised with the writers of the list like
+ * any other list function, but the snapshot itself can then be read on
+ * another thread while the list keeps changing. A snapshot has its own
+ * cursor and must only be used by one thread at a time. The elements are
+ * shared with the list, so the data pointers must not be written through.
+ */
+ListSnapshotHandle* ListSnapshot(List*);
+int ListSnapshotRelease(ListSnapshotHandle**);
+
+const void* ListSnapshotGetHeadData(ListSnapshotHandle*);
+const void* ListSnapshotGetTailData(ListSnapshotHandle*);
+const void* ListSnapshotGetNextData(ListSnapshotHandle*);
+const void* ListSnapshotGetPreviousData(ListSnapshotHandle*);
+size_t ListSnapshotGetLength(ListSnapshotHandle*);
+
+/**
+ * In RCU mode, readers may walk the list with ListRcuGetHeadData and
+ * ListRcuGetNextData inside EpochEnter/EpochExit of the list's domain,
+ * without any lock and concurrently with one writer at a time. They perform
+ * no stores to shared memory. Nodes removed by the writer are freed after
+ * a grace period of the domain. The other read functions move the list's
+ * cursor and remain writer-side functions.
+ */
+int ListEnableRcu(List*, EpochDomain* domain);
+const void* ListRcuGetHeadData(List*);
+const void* ListRcuGetNextData(List*, const void* data);
+
+int ListGetStats(List*, ListStats* stats);
+int ListResetStats(List*);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,202 @@
+/**
+ * @file linked_list_filter.c
+ * @author Manuel Haulez
+ * @brief Counting Bloom filter in front of the value searches of the linked list
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 Removed nodes only skipped while the list keeps any
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every live element increments FILTER_HASHES one-byte counters chosen by
+ * double hashing of its bytes, and decrements them again when it is removed.
+ * A search whose counters are not all set cannot match, so misses are
+ * answered without walking the list. The filter has
+ * FILTER_COUNTERS_PER_ELEMENT counters per expected element, about a 1%
+ * false-positive rate, and is rebuilt twice as large once the list outgrows
+ * it. A counter that reaches 255 stays there, so it never drops below the
+ * number of elements that map to it.
+ */
+
+#include <stdint.h>
+#include "linked_list_internal.h"
+
+#define FILTER_HASHES 4
+#define FILTER_COUNTERS_PER_ELEMENT 10
+#define FILTER_MINIMUM_CAPACITY 64
+#define FILTER_COUNTER_MAXIMUM 255
+
+static uint64_t MixBits(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
+
+static uint64_t HashBytes(const void* data, size_t length)
+{
+    const unsigned char* bytes = data;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)length;
+    size_t index = 0;
+
+    for (; index + 8 <= length; index += 8)
+    {
+        uint64_t word;
+        memcpy(&word, bytes + index, 8);
+        hash = MixBits(hash ^ word);
+    }
+
+    uint64_t tail = 0;
+
+    for (size_t shift = 0; index < length; index++, shift += 8)
+    {
+        tail |= (uint64_t)bytes[index] << shift;
+    }
+
+    return MixBits(hash ^ tail);
+}
+
+/**
+ * @brief Computes the counter indexes of a key.
+ */
+static void FilterIndexes(List* this, const void* data, size_t length, size_t* indexes)
+{
+    uint64_t hash = HashBytes(data, length);
+    uint64_t step = MixBits(hash) | 1;
+
+    for (int index = 0; index < FILTER_HASHES; index++)
+    {
+        indexes[index] = (size_t)(hash + (uint64_t)index * step) & this->filterMask;
+    }
+}
+
+static size_t ElementLength(List* this, const void* data)
+{
+    return this->payloads != NULL ? SlabArenaGetSize(data) : (size_t)this->dataSize;
+}
+
+/**
+ * @brief Allocates zeroed counters for capacity elements and counts every live element.
+ *
+ * @return Error code indicating the success of the operation; the old counters are kept on failure.
+ */
+static int RebuildFilter(List* this, size_t capacity)
+{
+    size_t counterCount = 1;
+
+    while (counterCount < capacity * FILTER_COUNTERS_PER_ELEMENT)
+    {
+        counterCount <<= 1;
+    }
+
+    unsigned char* counters = calloc(counterCount, 1);
+
+    if (counters == NULL)
+    {
+        return -1;
+    }
+
+    free(this->filterCounters);
+    this->filterCounters = counters;
+    this->filterMask = counterCount - 1;
+    this->filterCapacity = capacity;
+
+    for (Node* currentNode = ListSkipRemoved(this, this->head); currentNode != NULL;
+         currentNode = ListSkipRemoved(this, currentNode->next))
+    {
+        ListFilterInsert(this, currentNode->data);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Counts an element that has just been linked. Grows the filter when the list has outgrown it.
+ */
+void ListFilterInsert(List* this, const void* data)
+{
+    if (this->length > this->filterCapacity && RebuildFilter(this, this->filterCapacity * 2) == 0)
+    {
+        return;
+    }
+
+    size_t indexes[FILTER_HASHES];
+    FilterIndexes(this, data, ElementLength(this, data), indexes);
+
+    for (int index = 0; index < FILTER_HASHES; index++)
+    {
+        if (this->filterCounters[indexes[index]] < FILTER_COUNTER_MAXIMUM)
+        {
+            this->filterCounters[indexes[index]]++;
+        }
+    }
+}
+
+/**
+ * @brief Uncounts an element that is leaving the live list.
+ */
+void ListFilterErase(List* this, const void* data)
+{
+    size_t indexes[FILTER_HASHES];
+    FilterIndexes(this, data, ElementLength(this, data), indexes);
+
+    for (int index = 0; index < FILTER_HASHES; index++)
+    {
+        if (this->filterCounters[indexes[index]] < FILTER_COUNTER_MAXIMUM)
+        {
+            this->filterCounters[indexes[index]]--;
+        }
+    }
+}
+
+/**
+ * @brief Checks whether an element equal to the key may be in the list.
+ *
+ * @return 0 if no element equals the key, 1 if one might.
+ */
+int ListFilterMayContain(List* this, const void* data, size_t length)
+{
+    size_t indexes[FILTER_HASHES];
+    FilterIndexes(this, data, length, indexes);
+
+    for (int index = 0; index < FILTER_HASHES; index++)
+    {
+        if (this->filterCounters[indexes[index]] == 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Uncounts every element at once, after the list has been cleared.
+ */
+void ListFilterReset(List* this)
+{
+    memset(this->filterCounters, 0, this->filterMask + 1);
+}
+
+/**
+ * @brief Puts a counting Bloom filter in front of the searches by value, or resizes the existing one.
+ *
+ * @param List pointer to the linked list.
+ * @param Number of elements the list is expected to hold; the filter grows past it.
+ * @return Error code indicating the success of the operation.
+ */
+int ListEnableFilter(List* this, size_t expectedCount)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    size_t capacity = expectedCount > this->length ? expectedCount : this->length;
+
+    return RebuildFilter(this, capacity > FILTER_MINIMUM_CAPACITY ? capacity : FILTER_MINIMUM_CAPACITY);
+}
@@ -0,0 +1,199 @@
+/**
+ * @file linked_list_huge.c
+ * @author Manuel Haulez
+ * @brief Node storage of the linked list in huge-page backed slabs
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Nodes spread over the heap in 4 KiB pages cost a TLB entry for every few
+ * nodes a traversal touches. ListEnableHugePages makes the list carve its
+ * heap nodes from slabs of LIST_HUGE_SLAB_BYTES instead. A slab is first
+ * requested from the reserved huge page pool with MAP_HUGETLB; that pool is
+ * empty unless the administrator has filled it, so the usual outcome is the
+ * fallback: an ordinary anonymous mapping, aligned to the slab size and
+ * marked with madvise(MADV_HUGEPAGE), which transparent huge pages back with
+ * one huge page when the kernel allows it. Neither path needs privileges,
+ * and the slabs still work as plain memory when neither yields huge pages.
+ * Released nodes go to the pool of the list and the slabs are only unmapped
+ * when the list is freed.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <sys/mman.h>
+#include "linked_list_internal.h"
+
+/**
+ * next links the slabs of a list. The header takes the start of every slab,
+ * the nodes follow it.
+ */
+struct list_huge_slab
+{
+    ListHugeSlab* next;
+};
+
+#define HUGE_SLAB_HEADER_SIZE LIST_ALIGN_SIZE(sizeof(ListHugeSlab))
+
+/* Ask for 2 MiB pages even where the system's default huge page is larger. */
+#if defined(MAP_HUGE_2MB) && LIST_HUGE_SLAB_BYTES % (2 * 1024 * 1024) == 0
+#define HUGE_SLAB_PAGE_SIZE MAP_HUGE_2MB
+#else
+#define HUGE_SLAB_PAGE_SIZE 0
+#endif
+
+/**
+ * @brief Maps an anonymous region of LIST_HUGE_SLAB_BYTES aligned to its size.
+ *
+ * @return Pointer to the region, or NULL if the mapping failed.
+ */
+static void* MapSlab(void)
+{
+    void* slab;
+
+#ifdef MAP_HUGETLB
+    slab = mmap(NULL, LIST_HUGE_SLAB_BYTES, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | HUGE_SLAB_PAGE_SIZE, -1, 0);
+
+    if (slab != MAP_FAILED)
+    {
+        return slab;
+    }
+#endif
+
+    /* Map twice the size and trim it, so that the kernel can back it with whole huge pages. */
+    size_t mappedSize = 2 * (size_t)LIST_HUGE_SLAB_BYTES;
+    unsigned char* region = mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (region == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    uintptr_t aligned = ((uintptr_t)region + LIST_HUGE_SLAB_BYTES - 1) & ~((uintptr_t)LIST_HUGE_SLAB_BYTES - 1);
+    size_t leading = (size_t)(aligned - (uintptr_t)region);
+    size_t trailing = mappedSize - leading - LIST_HUGE_SLAB_BYTES;
+
+    if (leading > 0)
+    {
+        munmap(region, leading);
+    }
+
+    if (trailing > 0)
+    {
+        munmap((unsigned char*)aligned + LIST_HUGE_SLAB_BYTES, trailing);
+    }
+
+    slab = (void*)aligned;
+
+#ifdef MADV_HUGEPAGE
+    madvise(slab, LIST_HUGE_SLAB_BYTES, MADV_HUGEPAGE);
+#endif
+
+    return slab;
+}
+
+/**
+ * @brief Maps a new slab and makes it the one nodes are carved from.
+ *
+ * @return Error code indicating the success of the operation.
+ */
+static int AddSlab(List* this)
+{
+    ListHugeSlab* slab = MapSlab();
+
+    if (slab == NULL)
+    {
+        return -1;
+    }
+
+    slab->next = this->hugeSlabs;
+    this->hugeSlabs = slab;
+    this->hugeCursor = (unsigned char*)slab + HUGE_SLAB_HEADER_SIZE;
+    this->hugeEnd = (unsigned char*)slab + LIST_HUGE_SLAB_BYTES;
+
+    return 0;
+}
+
+/**
+ * @brief Carves a node of slotSize bytes from the current slab, mapping a new slab when it is used up.
+ *
+ * @return Pointer to the node, or NULL if no slab could be mapped.
+ */
+Node* ListHugeAllocate(List* this, ListOperation operation)
+{
+    (void)operation;
+
+    if ((size_t)(this->hugeEnd - this->hugeCursor) < this->slotSize)
+    {
+        if (AddSlab(this) == -1)
+        {
+            return NULL;
+        }
+
+        LIST_STATS_ADD(this, operation, allocations, 1);
+    }
+
+    Node* newNode = (Node*)this->hugeCursor;
+    this->hugeCursor += this->slotSize;
+
+    return newNode;
+}
+
+/**
+ * @brief Unmaps every slab, and with them every node that was carved from them.
+ */
+void ListHugeFree(List* this)
+{
+    while (this->hugeSlabs != NULL)
+    {
+        ListHugeSlab* nextSlab = this->hugeSlabs->next;
+        munmap(this->hugeSlabs, LIST_HUGE_SLAB_BYTES);
+        this->hugeSlabs = nextSlab;
+    }
+
+    this->hugeCursor = NULL;
+    this->hugeEnd = NULL;
+}
+
+/**
+ * @brief Switches an empty linked list to huge-page backed node slabs. Cannot be undone.
+ *
+ * Spare nodes set aside by ListReserve before are given back to malloc;
+ * from then on every released node is kept for reuse.
+ *
+ * @param List pointer to the linked list.
+ * @return Error code indicating the success of the operation; -1 if the list is not empty, is in RCU mode,
+ *         has issued node handles, has elements too large for a slab or no slab could be mapped.
+ */
+int ListEnableHugePages(List* this)
+{
+    if (this == NULL || this->head != NULL || this->rcuDomain != NULL || this->handles ||
+        this->slotSize > LIST_HUGE_SLAB_BYTES - HUGE_SLAB_HEADER_SIZE)
+    {
+        return -1;
+    }
+
+    if (this->hugeSlabs != NULL)
+    {
+        return 0;
+    }
+
+    if (AddSlab(this) == -1)
+    {
+        return -1;
+    }
+
+    while (this->pool != NULL)
+    {
+        Node* nextNode = this->pool->next;
+        free(this->pool);
+        this->pool = nextNode;
+    }
+
+    this->poolCount = 0;
+
+    return 0;
+}
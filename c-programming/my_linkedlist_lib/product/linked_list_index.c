@@ -0,0 +1,343 @@
+/**
+ * @file linked_list_index.c
+ * @author Manuel Haulez
+ * @brief Order-statistic tree over the nodes of the linked list for positional access
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 Entries referenced from the node tracks
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The index is a treap whose in-order sequence is the live list: every live
+ * node has one entry, and every entry knows the size of its subtree. The
+ * entry at a position is found by descending on the subtree sizes. A new
+ * entry is attached as the in-order successor of its predecessor's entry and
+ * rotated up while its random priority is below its parent's, which keeps
+ * the expected depth logarithmic without any rebalancing bookkeeping.
+ * Entries are found from their nodes through NodeTrack.indexEntry, so links
+ * and removals by value cost O(log n) as well; enabling the index therefore
+ * tracks the nodes of the list.
+ */
+
+#include <stdint.h>
+#include "linked_list_internal.h"
+
+struct list_index_entry
+{
+    Node* node;
+    ListIndexEntry* left;
+    ListIndexEntry* right;
+    ListIndexEntry* parent;
+    size_t size;
+    uint32_t priority;
+};
+
+struct list_index
+{
+    ListIndexEntry* root;
+    uint32_t seed;
+};
+
+static uint32_t NextPriority(ListIndex* index)
+{
+    uint32_t value = index->seed;
+
+    value ^= value << 13;
+    value ^= value >> 17;
+    value ^= value << 5;
+    index->seed = value;
+
+    return value;
+}
+
+static size_t SubtreeSize(const ListIndexEntry* entry)
+{
+    return entry != NULL ? entry->size : 0;
+}
+
+/**
+ * @brief Makes child take the place of entry under entry's parent.
+ */
+static void ReplaceChild(ListIndex* index, ListIndexEntry* entry, ListIndexEntry* child)
+{
+    ListIndexEntry* parent = entry->parent;
+
+    if (parent == NULL)
+    {
+        index->root = child;
+    }
+    else if (parent->left == entry)
+    {
+        parent->left = child;
+    }
+    else
+    {
+        parent->right = child;
+    }
+
+    if (child != NULL)
+    {
+        child->parent = parent;
+    }
+}
+
+/**
+ * @brief Rotates an entry above its parent, keeping the in-order sequence and the subtree sizes.
+ */
+static void RotateUp(ListIndex* index, ListIndexEntry* entry)
+{
+    ListIndexEntry* parent = entry->parent;
+
+    ReplaceChild(index, parent, entry);
+
+    if (parent->left == entry)
+    {
+        parent->left = entry->right;
+
+        if (entry->right != NULL)
+        {
+            entry->right->parent = parent;
+        }
+
+        entry->right = parent;
+    }
+    else
+    {
+        parent->right = entry->left;
+
+        if (entry->left != NULL)
+        {
+            entry->left->parent = parent;
+        }
+
+        entry->left = parent;
+    }
+
+    parent->parent = entry;
+    parent->size = 1 + SubtreeSize(parent->left) + SubtreeSize(parent->right);
+    entry->size = 1 + SubtreeSize(entry->left) + SubtreeSize(entry->right);
+}
+
+/**
+ * @brief Frees every entry of the tree.
+ */
+static void FreeEntries(ListIndex* index)
+{
+    ListIndexEntry* entry = index->root;
+
+    while (entry != NULL)
+    {
+        if (entry->left != NULL)
+        {
+            entry = entry->left;
+        }
+        else if (entry->right != NULL)
+        {
+            entry = entry->right;
+        }
+        else
+        {
+            ListIndexEntry* parent = entry->parent;
+
+            if (parent != NULL && parent->left == entry)
+            {
+                parent->left = NULL;
+            }
+            else if (parent != NULL)
+            {
+                parent->right = NULL;
+            }
+
+            free(entry);
+            entry = parent;
+        }
+    }
+
+    index->root = NULL;
+}
+
+/**
+ * @brief Adds the entry of a node that has just been linked. Drops the whole index if that fails.
+ */
+void ListIndexInsert(List* this, Node* node)
+{
+    ListIndex* index = this->index;
+    ListIndexEntry* entry = malloc(sizeof(ListIndexEntry));
+
+    if (entry == NULL)
+    {
+        ListIndexFree(this);
+        return;
+    }
+
+    Node* previousNode = ListSkipRemovedBackward(this, node->prev);
+
+    entry->node = node;
+    entry->left = NULL;
+    entry->right = NULL;
+    entry->size = 1;
+    entry->priority = NextPriority(index);
+    node->track->indexEntry = entry;
+
+    ListIndexEntry* parent = previousNode != NULL ? previousNode->track->indexEntry : index->root;
+
+    if (parent == NULL)
+    {
+        entry->parent = NULL;
+        index->root = entry;
+        return;
+    }
+
+    if (previousNode == NULL || parent->right != NULL)
+    {
+        parent = previousNode == NULL ? parent : parent->right;
+
+        while (parent->left != NULL)
+        {
+            parent = parent->left;
+        }
+
+        parent->left = entry;
+    }
+    else
+    {
+        parent->right = entry;
+    }
+
+    entry->parent = parent;
+
+    for (ListIndexEntry* ancestor = parent; ancestor != NULL; ancestor = ancestor->parent)
+    {
+        ancestor->size++;
+    }
+
+    while (entry->parent != NULL && entry->priority < entry->parent->priority)
+    {
+        RotateUp(index, entry);
+    }
+}
+
+/**
+ * @brief Removes the entry of a node that is leaving the live list.
+ */
+void ListIndexErase(List* this, Node* node)
+{
+    ListIndex* index = this->index;
+    ListIndexEntry* entry = node->track->indexEntry;
+
+    while (entry->left != NULL && entry->right != NULL)
+    {
+        RotateUp(index, entry->left->priority < entry->right->priority ? entry->left : entry->right);
+    }
+
+    ListIndexEntry* parent = entry->parent;
+
+    ReplaceChild(index, entry, entry->left != NULL ? entry->left : entry->right);
+
+    for (ListIndexEntry* ancestor = parent; ancestor != NULL; ancestor = ancestor->parent)
+    {
+        ancestor->size--;
+    }
+
+    node->track->indexEntry = NULL;
+    free(entry);
+}
+
+/**
+ * @brief Finds the live node at a position.
+ *
+ * @return Pointer to the node, or NULL if the position is past the end of the list.
+ */
+Node* ListIndexFindNode(List* this, ListOperation operation, size_t position)
+{
+    (void)operation;
+    ListIndexEntry* entry = this->index->root;
+
+    while (entry != NULL)
+    {
+        LIST_STATS_ADD(this, operation, nodesVisited, 1);
+        size_t leftSize = SubtreeSize(entry->left);
+
+        if (position == leftSize)
+        {
+            return entry->node;
+        }
+
+        if (position < leftSize)
+        {
+            entry = entry->left;
+        }
+        else
+        {
+            position -= leftSize + 1;
+            entry = entry->right;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Removes every entry at once, after the list has been cleared.
+ */
+void ListIndexReset(List* this)
+{
+    FreeEntries(this->index);
+}
+
+/**
+ * @brief Frees the index and turns positional access back into list walks.
+ */
+void ListIndexFree(List* this)
+{
+    if (this->index == NULL)
+    {
+        return;
+    }
+
+    FreeEntries(this->index);
+    free(this->index);
+    this->index = NULL;
+}
+
+/**
+ * @brief Builds the positional index over the elements already in the list.
+ *
+ * @param List pointer to the linked list.
+ * @return Error code indicating the success of the operation.
+ */
+int ListEnableIndex(List* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    if (this->index != NULL)
+    {
+        return 0;
+    }
+
+    if (ListTrackNodes(this) == -1)
+    {
+        return -1;
+    }
+
+    this->index = malloc(sizeof(ListIndex));
+
+    if (this->index == NULL)
+    {
+        return -1;
+    }
+
+    this->index->root = NULL;
+    this->index->seed = 0x9E3779B9u;
+
+    for (Node* currentNode = ListSkipRemoved(this, this->head); currentNode != NULL && this->index != NULL;
+         currentNode = ListSkipRemoved(this, currentNode->next))
+    {
+        ListIndexInsert(this, currentNode);
+    }
+
+    return this->index != NULL ? 0 : -1;
+}
@@ -0,0 +1,323 @@
+/**
+ * @file linked_list_internal.h
+ * @author Manuel Haulez
+ * @brief Node and list layout shared by the linked list translation units
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 Inline node slots
+ * @version 0.3 2026-10-19 Version stamps and deferred removal for snapshots
+ * @version 0.4 2026-10-19 RCU mode
+ * @version 0.5 2026-10-19 Pool of reserved heap nodes
+ * @version 0.6 2026-10-19 Variable-length payloads in a slab arena
+ * @version 0.7 2026-10-19 Counting Bloom filter in front of the value searches
+ * @version 0.8 2026-10-19 Order-statistic index for positional access
+ * @version 0.9 2026-10-19 Node handles
+ * @version 0.10 2026-10-19 Node checks and ListFreeStorage shared with the background reclaimer
+ * @version 0.11 2026-10-19 Huge-page backed node slabs
+ * @version 0.12 2026-10-19 Views over caller-owned arrays
+ * @version 0.13 2026-10-19 Version of untouched views
+ * @version 0.14 2026-10-19 Version stamps and index entry moved to node tracks of tracked lists
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Only the library's own .c files include this header; users see List as an
+ * opaque type through linked_list.h.
+ */
+
+#ifndef LINKED_LIST_INTERNAL_H
+#define LINKED_LIST_INTERNAL_H
+
+#include <stdint.h>
+#include "linked_list.h"
+#include "slab_arena.h"
+
+/**
+ * Number of nodes kept inside the list allocation itself. Up to this many
+ * elements the list performs no allocations beyond its own; further elements
+ * spill to heap nodes. Lists of large elements get fewer inline slots so the
+ * inline area stays below LIST_INLINE_BYTES.
+ */
+#ifndef LIST_INLINE_CAPACITY
+#define LIST_INLINE_CAPACITY 8
+#endif
+
+#ifndef LIST_INLINE_BYTES
+#define LIST_INLINE_BYTES 1024
+#endif
+
+/**
+ * Size of the slabs that pack the payloads of variable-length lists.
+ */
+#ifndef LIST_SLAB_BYTES
+#define LIST_SLAB_BYTES 4096
+#endif
+
+/**
+ * Size of the node slabs of lists with huge pages enabled; a multiple of the
+ * 2 MiB huge page size.
+ */
+#ifndef LIST_HUGE_SLAB_BYTES
+#define LIST_HUGE_SLAB_BYTES (2 * 1024 * 1024)
+#endif
+
+#if LIST_INLINE_CAPACITY < 0 || LIST_INLINE_CAPACITY > 32
+#error "LIST_INLINE_CAPACITY must be between 0 and 32"
+#endif
+
+/**
+ * Version a view list is constructed with. As every change of the list
+ * structure increments the version, a view at this version still links
+ * exactly the elements of its array, in array order.
+ */
+#define LIST_VIEW_VERSION 1
+
+typedef struct node Node;
+typedef struct node_track NodeTrack;
+typedef struct list_index ListIndex;
+typedef struct list_index_entry ListIndexEntry;
+typedef struct list_huge_slab ListHugeSlab;
+#define LIST_NODE_ALIVE ((unsigned long)-1)
+#define LIST_NODE_ALIGNMENT 16
+#define LIST_ALIGN_SIZE(size) (((size) + LIST_NODE_ALIGNMENT - 1) & ~(size_t)(LIST_NODE_ALIGNMENT - 1))
+
+/**
+ * A node and its payload share one block of slotSize bytes; data points
+ * LIST_ALIGN_SIZE(sizeof(Node)) bytes past the node. The block lives either in the inline slots of the list or
+ * on the heap.
+ *
+ * track is NULL until the list is tracked, see ListTrackNodes, so lists
+ * that never take a snapshot, enable the index or issue a handle keep a
+ * 32-byte node header.
+ */
+struct node
+{
+    void* data;
+    Node* prev;
+    Node* next;
+    NodeTrack* track;
+};
+
+/**
+ * The history of a node of a tracked list, allocated with the node and
+ * freed when the node is released.
+ *
+ * addedVersion and removedVersion are the list versions at which the node
+ * entered and left the list. While snapshots exist a removed node stays
+ * linked, so that the snapshots can still walk over it, and every traversal
+ * of the live list skips it. Nodes that were already linked when tracking
+ * started count as added at version 0.
+ *
+ * indexEntry is the node's entry in the positional index; it is only
+ * meaningful for live nodes of a list whose index is enabled.
+ */
+struct node_track
+{
+    unsigned long addedVersion;
+    unsigned long removedVersion;
+    ListIndexEntry* indexEntry;
+};
+
+/**
+ * Segment boundaries for the parallel scans. They are rebuilt by one walk over
+ * the list and reused for as long as the list structure stays unchanged.
+ */
+typedef struct list_segments ListSegments;
+struct list_segments
+{
+    Node** starts;
+    size_t* lengths;
+    int count;
+    unsigned long version;
+};
+
+/**
+ * references counts the owner plus every live snapshot; whoever drops the
+ * last one frees the list. removedCount is the number of removed nodes still
+ * linked for the sake of snapshots. In RCU mode rcuDomain receives the
+ * unlinked nodes, and the list itself, instead of freeing them at once.
+ * pool holds up to poolCapacity spare heap nodes of slotSize bytes, linked
+ * through next, that ListReserve set aside; released nodes refill it.
+ * Variable-length lists have a dataSize of 0 and header-only nodes whose
+ * payloads, prefixed with their length, are packed in the payloads arena.
+ * filterCounters, when not NULL, are the filterMask + 1 counters of the
+ * Bloom filter, sized for filterCapacity elements. index, when not NULL, is
+ * the order-statistic tree over the live nodes. handles is set once a node
+ * handle has been issued; from then on released heap nodes all go to the
+ * pool instead of back to malloc, so that a stale handle still points to
+ * node memory of the list. tracked is set once every node has a NodeTrack.
+ * hugeSlabs, when not NULL, are the huge-page
+ * backed slabs that heap nodes are carved from, the current one from
+ * hugeCursor up to hugeEnd; such a list keeps every released heap node in
+ * its pool. A view list keeps viewCount header-only nodes in the viewNodes
+ * block, whose payloads are the elements of the caller's array; neither is
+ * freed with the node.
+ */
+struct list
+{
+    Node* head;
+    Node* lastAccessed;
+    int dataSize;
+    size_t length;
+    unsigned long version;
+    ListSegments segments;
+    unsigned char* inlineSlots;
+    size_t slotSize;
+    unsigned int inlineFree;
+    int inlineCount;
+    unsigned long references;
+    size_t removedCount;
+    EpochDomain* rcuDomain;
+    Node* pool;
+    size_t poolCount;
+    size_t poolCapacity;
+    SlabArena* payloads;
+    unsigned char* filterCounters;
+    size_t filterMask;
+    size_t filterCapacity;
+    ListIndex* index;
+    int handles;
+    int tracked;
+    ListHugeSlab* hugeSlabs;
+    unsigned char* hugeCursor;
+    unsigned char* hugeEnd;
+    unsigned char* viewNodes;
+    size_t viewCount;
+#ifdef LIST_STATS
+    ListStats stats;
+#endif
+};
+
+#ifdef LIST_STATS
+#define LIST_STATS_ADD(list, operation, field, amount) ((list)->stats.op[(operation)].field += (amount))
+#define LIST_STATS_ADD_FILTER(list, field, amount) ((list)->stats.field += (amount))
+#else
+#define LIST_STATS_ADD(list, operation, field, amount) ((void)0)
+#define LIST_STATS_ADD_FILTER(list, field, amount) ((void)0)
+#endif
+
+/**
+ * @brief Retrieves the list version at which a node was removed, LIST_NODE_ALIVE while it is linked.
+ *
+ * Safe on threads that read the list concurrently with its writer.
+ */
+static inline unsigned long ListNodeRemovedVersion(Node* node)
+{
+    NodeTrack* track = __atomic_load_n(&node->track, __ATOMIC_ACQUIRE);
+
+    return track != NULL ? __atomic_load_n(&track->removedVersion, __ATOMIC_RELAXED) : LIST_NODE_ALIVE;
+}
+
+/**
+ * @brief Retrieves the list version at which a node was added.
+ */
+static inline unsigned long ListNodeAddedVersion(Node* node)
+{
+    NodeTrack* track = __atomic_load_n(&node->track, __ATOMIC_ACQUIRE);
+
+    return track != NULL ? track->addedVersion : 0;
+}
+
+/**
+ * @brief Returns node, or the first node after it still in the live list.
+ *
+ * Removed nodes only stay linked while removedCount is set, so every other
+ * list returns node without looking at it.
+ */
+static inline Node* ListSkipRemoved(List* this, Node* node)
+{
+    if (this->removedCount == 0)
+    {
+        return node;
+    }
+
+    while (node != NULL && ListNodeRemovedVersion(node) != LIST_NODE_ALIVE)
+    {
+        node = node->next;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Returns node, or the first node before it still in the live list.
+ */
+static inline Node* ListSkipRemovedBackward(List* this, Node* node)
+{
+    if (this->removedCount == 0)
+    {
+        return node;
+    }
+
+    while (node != NULL && ListNodeRemovedVersion(node) != LIST_NODE_ALIVE)
+    {
+        node = node->prev;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Checks whether a node occupies one of the inline slots of the list.
+ */
+static inline int ListIsInlineNode(List* this, Node* node)
+{
+    uintptr_t address = (uintptr_t)node;
+    uintptr_t begin = (uintptr_t)this->inlineSlots;
+
+    return address >= begin && address < begin + (size_t)this->inlineCount * this->slotSize;
+}
+
+/**
+ * @brief Checks whether a node is one of the nodes a view list was constructed with.
+ */
+static inline int ListIsViewNode(List* this, Node* node)
+{
+    uintptr_t address = (uintptr_t)node;
+    uintptr_t begin = (uintptr_t)this->viewNodes;
+
+    return address >= begin && address < begin + this->viewCount * LIST_ALIGN_SIZE(sizeof(Node));
+}
+
+/**
+ * @brief Checks whether the payload of a node is an adopted buffer rather than embedded in the node.
+ *
+ * The nodes of a view list point into the caller's array and count as adopted here as well.
+ */
+static inline int ListIsAdoptedNode(Node* node)
+{
+    return node->data != (unsigned char*)node + LIST_ALIGN_SIZE(sizeof(Node));
+}
+
+void ListFreeSegments(List*);
+void ListFree(List*);
+void ListFreeStorage(List*);
+int ListTrackNodes(List*);
+
+/**
+ * Bloom filter maintenance, only called while filterCounters is set. Insert
+ * expects the node to be linked already; erase must run before its payload
+ * is released.
+ */
+void ListFilterInsert(List*, const void* data);
+void ListFilterErase(List*, const void* data);
+int ListFilterMayContain(List*, const void* data, size_t length);
+void ListFilterReset(List*);
+
+/**
+ * Positional index maintenance, only called while index is set. Insert
+ * expects the node to be linked already; a failed insert frees the index.
+ */
+void ListIndexInsert(List*, Node* node);
+void ListIndexErase(List*, Node* node);
+Node* ListIndexFindNode(List*, ListOperation operation, size_t position);
+void ListIndexReset(List*);
+void ListIndexFree(List*);
+
+/**
+ * Huge-page slab storage, only called while hugeSlabs is set. Allocate
+ * returns a block of slotSize bytes.
+ */
+Node* ListHugeAllocate(List*, ListOperation operation);
+void ListHugeFree(List*);
+
+#endif
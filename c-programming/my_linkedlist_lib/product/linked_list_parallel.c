@@ -0,0 +1,304 @@
+/**
+ * @file linked_list_parallel.c
+ * @author Manuel Haulez
+ * @brief Parallel for-each and reduce over the elements of a linked list
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 Segments run on the default thread pool
+ * @version 0.3 2026-10-19 Removed nodes only skipped while the list keeps any
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The list is cut into one segment per thread by a single walk that records
+ * the first node of every segment. The boundaries are cached in the list and
+ * reused until the list structure changes, so repeated scans of an unchanged
+ * list skip the serial walk entirely.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <unistd.h>
+#include "linked_list_internal.h"
+#include "list_latency.h"
+#include "thread_pool.h"
+
+typedef struct segment_task SegmentTask;
+struct segment_task
+{
+    List* list;
+    Node* first;
+    size_t length;
+    ListVisitFunction visit;
+    ListReduceFunction reduce;
+    void* accumulator;
+    void* context;
+};
+
+/**
+ * @brief Frees the cached segment boundaries of the list.
+ */
+void ListFreeSegments(List* this)
+{
+    free(this->segments.starts);
+    free(this->segments.lengths);
+    memset(&this->segments, 0, sizeof(ListSegments));
+}
+
+/**
+ * @brief Ensures the cached segment boundaries match the current list structure and segment count.
+ *
+ * @return Error code indicating the success of the operation.
+ */
+static int BuildSegments(List* this, int segmentCount)
+{
+    ListSegments* segments = &this->segments;
+
+    if (segments->starts != NULL && segments->count == segmentCount && segments->version == this->version)
+    {
+        return 0;
+    }
+
+    if (segments->count != segmentCount)
+    {
+        ListFreeSegments(this);
+        segments->starts = malloc(sizeof(Node*) * segmentCount);
+        segments->lengths = malloc(sizeof(size_t) * segmentCount);
+
+        if (segments->starts == NULL || segments->lengths == NULL)
+        {
+            ListFreeSegments(this);
+            return -1;
+        }
+
+        segments->count = segmentCount;
+    }
+
+    size_t baseLength = this->length / segmentCount;
+    size_t extra = this->length % segmentCount;
+    Node* currentNode = ListSkipRemoved(this, this->head);
+
+    for (int index = 0; index < segmentCount; index++)
+    {
+        size_t length = baseLength + ((size_t)index < extra ? 1 : 0);
+
+        segments->starts[index] = currentNode;
+        segments->lengths[index] = length;
+
+        for (size_t step = 0; step < length; step++)
+        {
+            currentNode = ListSkipRemoved(this, currentNode->next);
+        }
+    }
+
+    segments->version = this->version;
+
+    return 0;
+}
+
+static void RunSegment(void* argument)
+{
+    SegmentTask* task = argument;
+    Node* currentNode = task->first;
+
+    for (size_t step = 0; step < task->length; step++)
+    {
+        if (task->visit != NULL)
+        {
+            task->visit(currentNode->data, task->context);
+        }
+        else
+        {
+            task->reduce(task->accumulator, currentNode->data, task->context);
+        }
+
+        currentNode = ListSkipRemoved(task->list, currentNode->next);
+    }
+}
+
+/**
+ * @brief Resolves the requested thread count: non-positive means one per online CPU, never more than elements.
+ */
+static int ResolveThreadCount(List* this, int threadCount)
+{
+    if (threadCount <= 0)
+    {
+        long onlineCpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = onlineCpus > 0 ? (int)onlineCpus : 1;
+    }
+
+    if ((size_t)threadCount > this->length)
+    {
+        threadCount = (int)this->length;
+    }
+
+    return threadCount;
+}
+
+/**
+ * @brief Runs every task, tasks 1..n-1 on the default thread pool and task 0 on the caller.
+ */
+static void RunTasks(SegmentTask* tasks, int taskCount)
+{
+    ThreadPool* pool = ThreadPoolGetDefault();
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+
+    for (int index = 1; index < taskCount; index++)
+    {
+        if (pool == NULL || ThreadPoolSubmit(pool, &group, RunSegment, &tasks[index]) == -1)
+        {
+            RunSegment(&tasks[index]);
+        }
+    }
+
+    RunSegment(&tasks[0]);
+
+    if (pool != NULL)
+    {
+        ThreadPoolWait(pool, &group);
+    }
+}
+
+/**
+ * @brief Prepares one task per segment; the caller fills in the callbacks.
+ *
+ * @return Array of tasks, or NULL on failure.
+ */
+static SegmentTask* CreateTasks(List* this, int taskCount, void* context)
+{
+    if (BuildSegments(this, taskCount) == -1)
+    {
+        return NULL;
+    }
+
+    SegmentTask* tasks = calloc(taskCount, sizeof(SegmentTask));
+
+    if (tasks == NULL)
+    {
+        return NULL;
+    }
+
+    for (int index = 0; index < taskCount; index++)
+    {
+        tasks[index].list = this;
+        tasks[index].first = this->segments.starts[index];
+        tasks[index].length = this->segments.lengths[index];
+        tasks[index].context = context;
+    }
+
+    return tasks;
+}
+
+/**
+ * @brief Calls visit on every element of the linked list, spreading the elements over several threads.
+ *
+ * @param List pointer to the linked list.
+ * @param Function called with each element's data and the context.
+ * @param Context pointer passed through to visit.
+ * @param Number of segments run in parallel; 0 uses one per online CPU.
+ * @return Error code indicating the success of the operation.
+ */
+int ListForEachParallel(List* this, ListVisitFunction visit, void* context, int threadCount)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_FOR_EACH_PARALLEL);
+
+    if (this == NULL || visit == NULL)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_FOR_EACH_PARALLEL, calls, 1);
+    threadCount = ResolveThreadCount(this, threadCount);
+
+    if (threadCount == 0)
+    {
+        return 0;
+    }
+
+    SegmentTask* tasks = CreateTasks(this, threadCount, context);
+
+    if (tasks == NULL)
+    {
+        return -1;
+    }
+
+    for (int index = 0; index < threadCount; index++)
+    {
+        tasks[index].visit = visit;
+    }
+
+    RunTasks(tasks, threadCount);
+    free(tasks);
+    LIST_STATS_ADD(this, LIST_OP_FOR_EACH_PARALLEL, nodesVisited, this->length);
+
+    return 0;
+}
+
+/**
+ * @brief Folds all elements of the linked list into result, spreading the elements over several threads.
+ *
+ * Every segment is folded into its own copy of the initial result with reduce,
+ * then the partial results are merged into result with combine in list order.
+ * The initial content of result must therefore be an identity of combine.
+ *
+ * @param List pointer to the linked list.
+ * @param Function folding one element's data into an accumulator.
+ * @param Function merging a partial accumulator into another.
+ * @param Pointer to the identity on input and the reduced value on output.
+ * @param Size of the result in bytes.
+ * @param Context pointer passed through to reduce and combine.
+ * @param Number of segments run in parallel; 0 uses one per online CPU.
+ * @return Error code indicating the success of the operation.
+ */
+int ListReduceParallel(List* this, ListReduceFunction reduce, ListCombineFunction combine,
+                       void* result, size_t resultSize, void* context, int threadCount)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_REDUCE_PARALLEL);
+
+    if (this == NULL || reduce == NULL || combine == NULL || result == NULL || resultSize == 0)
+    {
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_REDUCE_PARALLEL, calls, 1);
+    threadCount = ResolveThreadCount(this, threadCount);
+
+    if (threadCount == 0)
+    {
+        return 0;
+    }
+
+    SegmentTask* tasks = CreateTasks(this, threadCount, context);
+    unsigned char* partials = malloc(resultSize * threadCount);
+
+    if (tasks == NULL || partials == NULL)
+    {
+        free(tasks);
+        free(partials);
+        return -1;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_REDUCE_PARALLEL, allocations, 1);
+
+    for (int index = 0; index < threadCount; index++)
+    {
+        tasks[index].reduce = reduce;
+        tasks[index].accumulator = partials + resultSize * index;
+        memcpy(tasks[index].accumulator, result, resultSize);
+    }
+
+    RunTasks(tasks, threadCount);
+
+    memcpy(result, partials, resultSize);
+
+    for (int index = 1; index < threadCount; index++)
+    {
+        combine(result, partials + resultSize * index, context);
+    }
+
+    free(tasks);
+    free(partials);
+    LIST_STATS_ADD(this, LIST_OP_REDUCE_PARALLEL, nodesVisited, this->length);
+
+    return 0;
+}
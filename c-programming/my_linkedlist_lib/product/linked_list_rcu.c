@@ -0,0 +1,108 @@
+/**
+ * @file linked_list_rcu.c
+ * @author Manuel Haulez
+ * @brief RCU mode of the linked list: lock-free readers, epoch-based reclamation
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 Variable-length lists cannot switch to RCU mode
+ * @version 0.3 2026-10-19 Lists that issued node handles cannot switch to RCU mode
+ * @version 0.4 2026-10-19 Lists with huge-page node slabs cannot switch to RCU mode
+ * @version 0.5 2026-10-19 Removal read from the node track
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Writers already publish every link change with release stores and keep the
+ * links of an unlinked node intact. In RCU mode they additionally retire
+ * unlinked nodes to an epoch domain instead of freeing them, so a reader
+ * inside a critical section can follow next pointers with plain acquire
+ * loads and never touches shared memory. Readers carry no cursor in the list;
+ * the position is the data pointer of the current element.
+ */
+
+#include "linked_list_internal.h"
+
+/**
+ * @brief Returns node, or the first node after it that has not been removed.
+ */
+static Node* SkipRemoved(Node* node)
+{
+    while (node != NULL && ListNodeRemovedVersion(node) != LIST_NODE_ALIVE)
+    {
+        node = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Switches an empty linked list to RCU mode. Cannot be undone.
+ *
+ * Nodes are no longer placed in the inline slots of the list, because a slot
+ * could be reused while a reader still stands on it.
+ *
+ * @param List pointer to the linked list.
+ * @param Epoch domain the readers use, or NULL for the default domain.
+ * @return Error code indicating the success of the operation; -1 if the list is not empty, variable-length,
+ *         has issued node handles or keeps its nodes in huge-page slabs.
+ */
+int ListEnableRcu(List* this, EpochDomain* domain)
+{
+    if (this == NULL || this->head != NULL || this->rcuDomain != NULL || this->payloads != NULL ||
+        this->handles || this->hugeSlabs != NULL)
+    {
+        return -1;
+    }
+
+    if (domain == NULL)
+    {
+        domain = EpochDomainGetDefault();
+
+        if (domain == NULL)
+        {
+            return -1;
+        }
+    }
+
+    this->rcuDomain = domain;
+    this->inlineFree = 0;
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the head data of an RCU list. Call inside an epoch critical section.
+ *
+ * @param List pointer to the linked list.
+ * @return Pointer to the data in the head node, or NULL if the list is empty.
+ */
+const void* ListRcuGetHeadData(List* this)
+{
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    Node* headNode = SkipRemoved(__atomic_load_n(&this->head, __ATOMIC_ACQUIRE));
+
+    return headNode != NULL ? headNode->data : NULL;
+}
+
+/**
+ * @brief Retrieves the data following an element of an RCU list. Call inside the same critical section.
+ *
+ * @param List pointer to the linked list.
+ * @param Data pointer returned by ListRcuGetHeadData or ListRcuGetNextData.
+ * @return Pointer to the data in the next node, or NULL if there is no next node.
+ */
+const void* ListRcuGetNextData(List* this, const void* data)
+{
+    if (this == NULL || data == NULL)
+    {
+        return NULL;
+    }
+
+    Node* node = (Node*)((const unsigned char*)data - LIST_ALIGN_SIZE(sizeof(Node)));
+    Node* nextNode = SkipRemoved(__atomic_load_n(&node->next, __ATOMIC_ACQUIRE));
+
+    return nextNode != NULL ? nextNode->data : NULL;
+}
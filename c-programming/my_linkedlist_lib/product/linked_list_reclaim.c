@@ -0,0 +1,361 @@
+/**
+ * @file linked_list_reclaim.c
+ * @author Manuel Haulez
+ * @brief Background reclamation of cleared and destructed linked lists
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 Lists with huge-page node slabs are reclaimed synchronously
+ * @version 0.3 2026-10-19 View lists are reclaimed synchronously
+ * @version 0.4 2026-10-19 Node tracks freed with their nodes
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * ListClearAsync and ListDestructAsync detach the node chain in constant
+ * time and queue it for one process-wide reclaimer thread, started on first
+ * use. The thread frees batchSize nodes at a time and sleeps pauseMicroseconds
+ * between batches, so that it does not compete with the application for the
+ * allocator. A cleared list keeps its inline slots: the at most
+ * LIST_INLINE_CAPACITY inline nodes are spliced out of the chain before it is
+ * queued. A destructed list is queued whole and its inline nodes are freed
+ * with it.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <pthread.h>
+#include <time.h>
+#include "linked_list_internal.h"
+#include "list_latency.h"
+
+#define RECLAIM_DEFAULT_BATCH 4096
+#define RECLAIM_DEFAULT_PAUSE_MICROSECONDS 100
+
+/**
+ * nodes is a chain linked through next. list is the destructed list the
+ * chain belongs to, or NULL for the chain of a cleared list, which holds
+ * neither inline nodes nor arena payloads.
+ */
+typedef struct reclaim_job ReclaimJob;
+struct reclaim_job
+{
+    ReclaimJob* next;
+    Node* nodes;
+    List* list;
+};
+
+typedef struct reclaimer Reclaimer;
+struct reclaimer
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t workAvailable;
+    pthread_cond_t idle;
+    ReclaimJob* head;
+    ReclaimJob* tail;
+    int busy;
+    int started;
+    size_t batchSize;
+    unsigned long pauseMicroseconds;
+};
+
+static Reclaimer reclaimer = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+                              NULL, NULL, 0, 0, RECLAIM_DEFAULT_BATCH, RECLAIM_DEFAULT_PAUSE_MICROSECONDS};
+static pthread_once_t reclaimerOnce = PTHREAD_ONCE_INIT;
+
+static void Pause(unsigned long microseconds)
+{
+    struct timespec duration = {(time_t)(microseconds / 1000000), (long)(microseconds % 1000000) * 1000};
+
+    nanosleep(&duration, NULL);
+}
+
+/**
+ * @brief Frees a chain of nodes, pausing after every batch, then the destructed list if any.
+ */
+static void FreeNodes(Node* nodes, List* list, size_t batchSize, unsigned long pauseMicroseconds)
+{
+    Node* currentNode = nodes;
+    size_t freed = 0;
+
+    while (currentNode != NULL)
+    {
+        Node* nextNode = currentNode->next;
+
+        free(currentNode->track);
+
+        if (list == NULL || list->payloads == NULL)
+        {
+            if (ListIsAdoptedNode(currentNode))
+            {
+                free(currentNode->data);
+            }
+        }
+
+        if (list == NULL || !ListIsInlineNode(list, currentNode))
+        {
+            free(currentNode);
+
+            if (++freed % batchSize == 0 && pauseMicroseconds > 0)
+            {
+                Pause(pauseMicroseconds);
+            }
+        }
+
+        currentNode = nextNode;
+    }
+
+    if (list != NULL)
+    {
+        ListFreeStorage(list);
+    }
+}
+
+static void* ReclaimerMain(void* argument)
+{
+    (void)argument;
+    pthread_mutex_lock(&reclaimer.mutex);
+
+    for (;;)
+    {
+        while (reclaimer.head == NULL)
+        {
+            pthread_cond_wait(&reclaimer.workAvailable, &reclaimer.mutex);
+        }
+
+        ReclaimJob* job = reclaimer.head;
+        reclaimer.head = job->next;
+        reclaimer.tail = reclaimer.head != NULL ? reclaimer.tail : NULL;
+        reclaimer.busy = 1;
+
+        size_t batchSize = reclaimer.batchSize;
+        unsigned long pauseMicroseconds = reclaimer.pauseMicroseconds;
+
+        pthread_mutex_unlock(&reclaimer.mutex);
+        FreeNodes(job->nodes, job->list, batchSize, pauseMicroseconds);
+        free(job);
+        pthread_mutex_lock(&reclaimer.mutex);
+
+        reclaimer.busy = 0;
+
+        if (reclaimer.head == NULL)
+        {
+            pthread_cond_broadcast(&reclaimer.idle);
+        }
+    }
+
+    return NULL;
+}
+
+static void StartReclaimer(void)
+{
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, ReclaimerMain, NULL) == 0)
+    {
+        pthread_detach(thread);
+        reclaimer.started = 1;
+    }
+}
+
+/**
+ * @brief Hands a chain of nodes, and optionally its list, to the reclaimer thread.
+ *
+ * @return Error code indicating the success of the operation; on failure the caller still owns everything.
+ */
+static int QueueJob(Node* nodes, List* list)
+{
+    pthread_once(&reclaimerOnce, StartReclaimer);
+
+    ReclaimJob* job = reclaimer.started ? malloc(sizeof(ReclaimJob)) : NULL;
+
+    if (job == NULL)
+    {
+        return -1;
+    }
+
+    job->next = NULL;
+    job->nodes = nodes;
+    job->list = list;
+
+    pthread_mutex_lock(&reclaimer.mutex);
+
+    if (reclaimer.tail == NULL)
+    {
+        reclaimer.head = job;
+    }
+    else
+    {
+        reclaimer.tail->next = job;
+    }
+
+    reclaimer.tail = job;
+    pthread_cond_signal(&reclaimer.workAvailable);
+    pthread_mutex_unlock(&reclaimer.mutex);
+
+    return 0;
+}
+
+/**
+ * @brief Checks whether the list can hand its nodes to the reclaimer at all.
+ *
+ * RCU lists already defer their frees to the epoch domain, nodes seen by a
+ * snapshot or named by a handle must stay where they are, variable-length
+ * payloads belong to the list's arena and index entries point to the nodes.
+ * Nodes carved from huge-page slabs or allocated in one block for a view
+ * cannot be passed to free one by one.
+ */
+static int CanReclaimAsync(List* this)
+{
+    return this->rcuDomain == NULL && __atomic_load_n(&this->references, __ATOMIC_ACQUIRE) == 1 &&
+           this->payloads == NULL && this->index == NULL && !this->handles && this->hugeSlabs == NULL &&
+           this->viewNodes == NULL;
+}
+
+/**
+ * @brief Clears the linked list like ListClear, but frees the heap nodes on the reclaimer thread.
+ *
+ * Lists that cannot hand their nodes over are cleared synchronously.
+ *
+ * @param List pointer to the linked list.
+ * @return Error code indicating the success of the operation.
+ */
+int ListClearAsync(List* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    if (!CanReclaimAsync(this))
+    {
+        return ListClear(this);
+    }
+
+    LIST_LATENCY_SCOPE(LIST_OP_CLEAR);
+    LIST_STATS_ADD(this, LIST_OP_CLEAR, calls, 1);
+
+    for (int slot = 0; slot < this->inlineCount; slot++)
+    {
+        if (this->inlineFree & (1u << slot))
+        {
+            continue;
+        }
+
+        Node* node = (Node*)(this->inlineSlots + (size_t)slot * this->slotSize);
+
+        if (node->prev == NULL)
+        {
+            this->head = node->next;
+        }
+        else
+        {
+            node->prev->next = node->next;
+        }
+
+        if (node->next != NULL)
+        {
+            node->next->prev = node->prev;
+        }
+
+        if (ListIsAdoptedNode(node))
+        {
+            free(node->data);
+        }
+
+        free(node->track);
+        node->track = NULL;
+        this->inlineFree |= 1u << slot;
+        LIST_STATS_ADD(this, LIST_OP_CLEAR, nodesVisited, 1);
+    }
+
+    Node* nodes = this->head;
+
+    this->head = NULL;
+    this->lastAccessed = NULL;
+    this->length = 0;
+    this->removedCount = 0;
+    this->version++;
+
+    if (this->filterCounters != NULL)
+    {
+        ListFilterReset(this);
+    }
+
+    if (nodes != NULL && QueueJob(nodes, NULL) == -1)
+    {
+        FreeNodes(nodes, NULL, (size_t)-1, 0);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Destructs a linked list like ListDestruct, but frees it on the reclaimer thread.
+ *
+ * @param Pointer to a list pointer to the linked list to be destructed.
+ * @return Error code indicating the success of the destruction operation.
+ */
+int ListDestructAsync(List** thisPtr)
+{
+    if (thisPtr == NULL || *thisPtr == NULL)
+    {
+        return -1;
+    }
+
+    List* list = *thisPtr;
+
+    if (list->rcuDomain != NULL || __atomic_load_n(&list->references, __ATOMIC_ACQUIRE) != 1 ||
+        list->hugeSlabs != NULL || list->viewNodes != NULL)
+    {
+        return ListDestruct(thisPtr);
+    }
+
+    Node* nodes = list->head;
+    list->head = NULL;
+
+    if (QueueJob(nodes, list) == -1)
+    {
+        list->head = nodes;
+        return ListDestruct(thisPtr);
+    }
+
+    *thisPtr = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Sets the pace of the reclaimer thread for the jobs it starts from now on.
+ *
+ * @param Number of nodes freed between two pauses.
+ * @param Length of the pauses in microseconds, 0 for none.
+ * @return Error code indicating the success of the operation.
+ */
+int ListReclaimerConfigure(size_t batchSize, unsigned long pauseMicroseconds)
+{
+    if (batchSize == 0)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&reclaimer.mutex);
+    reclaimer.batchSize = batchSize;
+    reclaimer.pauseMicroseconds = pauseMicroseconds;
+    pthread_mutex_unlock(&reclaimer.mutex);
+
+    return 0;
+}
+
+/**
+ * @brief Waits until the reclaimer thread has freed everything queued so far.
+ */
+void ListReclaimerDrain(void)
+{
+    pthread_mutex_lock(&reclaimer.mutex);
+
+    while (reclaimer.head != NULL || reclaimer.busy)
+    {
+        pthread_cond_wait(&reclaimer.idle, &reclaimer.mutex);
+    }
+
+    pthread_mutex_unlock(&reclaimer.mutex);
+}
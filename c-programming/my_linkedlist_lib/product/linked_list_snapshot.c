@@ -0,0 +1,239 @@
+/**
+ * @file linked_list_snapshot.c
+ * @author Manuel Haulez
+ * @brief Read-only snapshots of a linked list
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 The first snapshot of a list starts tracking its nodes
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The first snapshot gives every node of the list a track holding the list
+ * versions at which it was added and removed; lists that are never
+ * snapshotted do without. A snapshot only records the current version, so
+ * taking one is O(1) and copies nothing once the list is tracked. It sees exactly the nodes added at or before its version
+ * and removed after it. While any snapshot is alive the list keeps removed
+ * nodes linked instead of freeing them; nodes are never moved, so the
+ * physical node order stays a superset of every version's order. The kept
+ * nodes are freed by the first list update after the last snapshot has been
+ * released.
+ *
+ * Writers publish new nodes with release stores after initialising them, and
+ * the snapshot functions follow the links with acquire loads. This lets a
+ * snapshot be read on another thread while the writers continue.
+ */
+
+#include "linked_list_internal.h"
+#include "list_latency.h"
+
+struct list_snapshot
+{
+    List* list;
+    Node* lastAccessed;
+    unsigned long version;
+    size_t length;
+};
+
+/**
+ * @brief Checks whether a node belongs to the list version of the snapshot.
+ */
+static int IsVisible(ListSnapshotHandle* this, Node* node)
+{
+    return ListNodeAddedVersion(node) <= this->version && ListNodeRemovedVersion(node) > this->version;
+}
+
+/**
+ * @brief Returns node, or the first node after it visible in the snapshot.
+ */
+static Node* SkipForward(ListSnapshotHandle* this, Node* node)
+{
+    while (node != NULL && !IsVisible(this, node))
+    {
+        node = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Returns node, or the first node before it visible in the snapshot.
+ */
+static Node* SkipBackward(ListSnapshotHandle* this, Node* node)
+{
+    while (node != NULL && !IsVisible(this, node))
+    {
+        node = __atomic_load_n(&node->prev, __ATOMIC_ACQUIRE);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Takes a read-only snapshot of the current content of the linked list in O(1).
+ *
+ * The list stays usable and may be destructed before the snapshot; it is
+ * freed when the last snapshot is released. The first snapshot of a list
+ * tracks its nodes in O(n).
+ *
+ * @param List pointer to the linked list.
+ * @return Pointer to the snapshot, or NULL on failure.
+ */
+ListSnapshotHandle* ListSnapshot(List* this)
+{
+    LIST_LATENCY_SCOPE(LIST_OP_SNAPSHOT);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_SNAPSHOT, calls, 1);
+
+    if (ListTrackNodes(this) == -1)
+    {
+        return NULL;
+    }
+
+    ListSnapshotHandle* snapshot = malloc(sizeof(ListSnapshotHandle));
+
+    if (snapshot == NULL)
+    {
+        return NULL;
+    }
+
+    LIST_STATS_ADD(this, LIST_OP_SNAPSHOT, allocations, 1);
+    snapshot->list = this;
+    snapshot->lastAccessed = NULL;
+    snapshot->version = this->version;
+    snapshot->length = this->length;
+    __atomic_add_fetch(&this->references, 1, __ATOMIC_RELAXED);
+
+    return snapshot;
+}
+
+/**
+ * @brief Releases a snapshot. Releasing the last snapshot of a destructed list frees the list.
+ *
+ * @param Double pointer to the snapshot.
+ * @return Error code indicating the success of the operation.
+ */
+int ListSnapshotRelease(ListSnapshotHandle** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    List* list = (*this)->list;
+
+    free(*this);
+    *this = NULL;
+
+    if (__atomic_sub_fetch(&list->references, 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        ListFree(list);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the head data of the snapshot.
+ *
+ * @param Snapshot pointer.
+ * @return Pointer to the data in the head node, or NULL if the snapshot is empty.
+ */
+const void* ListSnapshotGetHeadData(ListSnapshotHandle* this)
+{
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    this->lastAccessed = SkipForward(this, __atomic_load_n(&this->list->head, __ATOMIC_ACQUIRE));
+
+    return this->lastAccessed != NULL ? this->lastAccessed->data : NULL;
+}
+
+/**
+ * @brief Retrieves the tail data of the snapshot.
+ *
+ * @param Snapshot pointer.
+ * @return Pointer to the data in the tail node, or NULL if the snapshot is empty.
+ */
+const void* ListSnapshotGetTailData(ListSnapshotHandle* this)
+{
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    Node* currentNode = __atomic_load_n(&this->list->head, __ATOMIC_ACQUIRE);
+    Node* tailNode = NULL;
+
+    while (currentNode != NULL)
+    {
+        if (IsVisible(this, currentNode))
+        {
+            tailNode = currentNode;
+        }
+
+        currentNode = __atomic_load_n(&currentNode->next, __ATOMIC_ACQUIRE);
+    }
+
+    this->lastAccessed = tailNode;
+
+    return tailNode != NULL ? tailNode->data : NULL;
+}
+
+/**
+ * @brief Retrieves the data after the last accessed node of the snapshot.
+ *
+ * @param Snapshot pointer.
+ * @return Pointer to the data in the next node, or NULL if there is no next node.
+ */
+const void* ListSnapshotGetNextData(ListSnapshotHandle* this)
+{
+    if (this == NULL || this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    this->lastAccessed = SkipForward(this, __atomic_load_n(&this->lastAccessed->next, __ATOMIC_ACQUIRE));
+
+    return this->lastAccessed != NULL ? this->lastAccessed->data : NULL;
+}
+
+/**
+ * @brief Retrieves the data before the last accessed node of the snapshot.
+ *
+ * @param Snapshot pointer.
+ * @return Pointer to the data in the previous node, or NULL if there is no previous node.
+ */
+const void* ListSnapshotGetPreviousData(ListSnapshotHandle* this)
+{
+    if (this == NULL || this->lastAccessed == NULL)
+    {
+        return NULL;
+    }
+
+    this->lastAccessed = SkipBackward(this, __atomic_load_n(&this->lastAccessed->prev, __ATOMIC_ACQUIRE));
+
+    return this->lastAccessed != NULL ? this->lastAccessed->data : NULL;
+}
+
+/**
+ * @brief Retrieves the number of elements in the snapshot.
+ *
+ * @param Snapshot pointer.
+ * @return The number of elements, or 0 if the snapshot is NULL.
+ */
+size_t ListSnapshotGetLength(ListSnapshotHandle* this)
+{
+    if (this == NULL)
+    {
+        return 0;
+    }
+
+    return this->length;
+}
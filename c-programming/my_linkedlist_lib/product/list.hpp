@@ -0,0 +1,497 @@
+/**
+ * @file list.hpp
+ * @author Manuel Haulez
+ * @brief Generic doubly linked list template for C++17
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 remove accepts a value that is an element of the list
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * utilities::List<T, Alloc> follows the design of linked_list.h (one node per
+ * element, prev/next links) but stores T by value inside the node and
+ * constructs it in place, so non-trivial and move-only types are handled
+ * correctly and emplace_back/emplace_front never copy. Nodes are obtained from
+ * Alloc rebound to the node type. A sentinel node closes the list into a ring,
+ * which makes end() decrementable and every insert and erase O(1) given an
+ * iterator.
+ */
+
+#ifndef UTILITIES_LIST_HPP
+#define UTILITIES_LIST_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace utilities
+{
+
+namespace detail
+{
+
+struct ListNodeBase
+{
+    ListNodeBase* prev;
+    ListNodeBase* next;
+};
+
+template <typename T>
+struct ListNode : ListNodeBase
+{
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+};
+
+} // namespace detail
+
+template <typename T, typename Alloc = std::allocator<T>>
+class List
+{
+    using Node = detail::ListNode<T>;
+    using NodeBase = detail::ListNodeBase;
+    using ValueTraits = std::allocator_traits<Alloc>;
+    using NodeAllocator = typename ValueTraits::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    template <bool IsConst>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() noexcept = default;
+
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) noexcept : node_(other.node_)
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return *static_cast<Node*>(node_)->value();
+        }
+
+        pointer operator->() const noexcept
+        {
+            return static_cast<Node*>(node_)->value();
+        }
+
+        Iterator& operator++() noexcept
+        {
+            node_ = node_->next;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            node_ = node_->next;
+            return previous;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            node_ = node_->prev;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            Iterator previous = *this;
+            node_ = node_->prev;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.node_ == rhs.node_;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.node_ != rhs.node_;
+        }
+
+    private:
+        friend class List;
+        friend class Iterator<!IsConst>;
+
+        explicit Iterator(NodeBase* node) noexcept : node_(node)
+        {
+        }
+
+        NodeBase* node_ = nullptr;
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    List() noexcept(noexcept(Alloc())) : List(Alloc())
+    {
+    }
+
+    explicit List(const Alloc& allocator) noexcept : allocator_(allocator)
+    {
+        ResetSentinel();
+    }
+
+    List(std::initializer_list<T> values, const Alloc& allocator = Alloc()) : List(allocator)
+    {
+        for (const T& value : values)
+        {
+            emplace_back(value);
+        }
+    }
+
+    List(const List& other)
+        : List(NodeTraits::select_on_container_copy_construction(other.allocator_))
+    {
+        for (const T& value : other)
+        {
+            emplace_back(value);
+        }
+    }
+
+    List(List&& other) noexcept : allocator_(std::move(other.allocator_))
+    {
+        ResetSentinel();
+        StealNodes(other);
+    }
+
+    ~List()
+    {
+        clear();
+    }
+
+    List& operator=(const List& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+        {
+            allocator_ = other.allocator_;
+        }
+
+        for (const T& value : other)
+        {
+            emplace_back(value);
+        }
+
+        return *this;
+    }
+
+    List& operator=(List&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value ||
+                                           NodeTraits::is_always_equal::value)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+        {
+            allocator_ = std::move(other.allocator_);
+            StealNodes(other);
+        }
+        else
+        {
+            if (allocator_ == other.allocator_)
+            {
+                StealNodes(other);
+            }
+            else
+            {
+                for (T& value : other)
+                {
+                    emplace_back(std::move(value));
+                }
+                other.clear();
+            }
+        }
+
+        return *this;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type(allocator_);
+    }
+
+    iterator begin() noexcept { return iterator(sentinel_.next); }
+    const_iterator begin() const noexcept { return const_iterator(sentinel_.next); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(&sentinel_); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<NodeBase*>(&sentinel_)); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *std::prev(end()); }
+    const_reference back() const { return *std::prev(end()); }
+
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        Node* node = CreateNode(std::forward<Args>(args)...);
+        LinkBefore(position.node_, node);
+        return iterator(node);
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        return *emplace(cend(), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    reference emplace_front(Args&&... args)
+    {
+        return *emplace(cbegin(), std::forward<Args>(args)...);
+    }
+
+    iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+    iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    iterator erase(const_iterator position) noexcept
+    {
+        NodeBase* next = position.node_->next;
+        Unlink(position.node_);
+        DestroyNode(static_cast<Node*>(position.node_));
+        return iterator(next);
+    }
+
+    void pop_front() noexcept { erase(cbegin()); }
+    void pop_back() noexcept { erase(std::prev(cend())); }
+
+    /**
+     * @brief Removes every element equal to value, mirroring ListRemove for all matches.
+     *
+     * value may refer to an element of the list; that element is erased last,
+     * after every comparison against it has been made.
+     *
+     * @return The number of removed elements.
+     */
+    size_type remove(const T& value)
+    {
+        size_type removed = 0;
+        const_iterator aliased = cend();
+
+        for (const_iterator position = cbegin(); position != cend();)
+        {
+            if (!(*position == value))
+            {
+                ++position;
+            }
+            else if (std::addressof(*position) == std::addressof(value))
+            {
+                aliased = position++;
+            }
+            else
+            {
+                position = erase(position);
+                removed++;
+            }
+        }
+
+        if (aliased != cend())
+        {
+            erase(aliased);
+            removed++;
+        }
+
+        return removed;
+    }
+
+    void clear() noexcept
+    {
+        NodeBase* current = sentinel_.next;
+
+        while (current != &sentinel_)
+        {
+            NodeBase* next = current->next;
+            DestroyNode(static_cast<Node*>(current));
+            current = next;
+        }
+
+        ResetSentinel();
+    }
+
+    void swap(List& other) noexcept
+    {
+        NodeBase tempSentinel;
+        size_type tempSize = size_;
+
+        MoveRing(sentinel_, tempSentinel, size_);
+        MoveRing(other.sentinel_, sentinel_, other.size_);
+        MoveRing(tempSentinel, other.sentinel_, tempSize);
+        size_ = other.size_;
+        other.size_ = tempSize;
+
+        if constexpr (NodeTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(allocator_, other.allocator_);
+        }
+    }
+
+private:
+    void ResetSentinel() noexcept
+    {
+        sentinel_.prev = &sentinel_;
+        sentinel_.next = &sentinel_;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Re-anchors the ring closed by from onto the sentinel to.
+     */
+    static void MoveRing(NodeBase& from, NodeBase& to, size_type count) noexcept
+    {
+        if (count == 0)
+        {
+            to.prev = &to;
+            to.next = &to;
+            return;
+        }
+
+        to.next = from.next;
+        to.prev = from.prev;
+        to.next->prev = &to;
+        to.prev->next = &to;
+    }
+
+    /**
+     * @brief Takes over the nodes of other, which must use an equal allocator; this must be empty.
+     */
+    void StealNodes(List& other) noexcept
+    {
+        MoveRing(other.sentinel_, sentinel_, other.size_);
+        size_ = other.size_;
+        other.ResetSentinel();
+    }
+
+    template <typename... Args>
+    Node* CreateNode(Args&&... args)
+    {
+        Node* node = ::new (static_cast<void*>(NodeTraits::allocate(allocator_, 1))) Node;
+
+        try
+        {
+            Alloc valueAllocator(allocator_);
+            ValueTraits::construct(valueAllocator, node->value(), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            NodeTraits::deallocate(allocator_, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    void DestroyNode(Node* node) noexcept
+    {
+        Alloc valueAllocator(allocator_);
+        ValueTraits::destroy(valueAllocator, node->value());
+        NodeTraits::deallocate(allocator_, node, 1);
+    }
+
+    void LinkBefore(NodeBase* position, NodeBase* node) noexcept
+    {
+        node->next = position;
+        node->prev = position->prev;
+        position->prev->next = node;
+        position->prev = node;
+        size_++;
+    }
+
+    void Unlink(NodeBase* node) noexcept
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        size_--;
+    }
+
+    NodeAllocator allocator_;
+    NodeBase sentinel_;
+    size_type size_ = 0;
+};
+
+template <typename T, typename Alloc>
+bool operator==(const List<T, Alloc>& lhs, const List<T, Alloc>& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    auto right = rhs.begin();
+
+    for (const T& value : lhs)
+    {
+        if (!(value == *right))
+        {
+            return false;
+        }
+        ++right;
+    }
+
+    return true;
+}
+
+template <typename T, typename Alloc>
+bool operator!=(const List<T, Alloc>& lhs, const List<T, Alloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename T, typename Alloc>
+void swap(List<T, Alloc>& lhs, List<T, Alloc>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace utilities
+
+#endif
@@ -0,0 +1,398 @@
+/**
+ * @file list_latency.c
+ * @author Manuel Haulez
+ * @brief Sampled per-operation latency histograms for the linked list
+ * @version 0.1 2026-10-19 Initial version
+ * @version 0.2 2026-10-19 One sample countdown per operation
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+#include "list_latency.h"
+
+#if defined(LIST_LATENCY_RDTSC) && defined(__x86_64__)
+#include <x86intrin.h>
+#define LIST_LATENCY_USE_RDTSC
+#endif
+
+#define SUB_BUCKET_BITS 4
+#define SUB_BUCKET_COUNT (1 << SUB_BUCKET_BITS)
+#define BUCKET_COUNT (64 * SUB_BUCKET_COUNT)
+
+static unsigned long long histogram[LIST_OP_COUNT][BUCKET_COUNT];
+static unsigned long long maximum[LIST_OP_COUNT];
+static unsigned int sampleInterval = LIST_LATENCY_DEFAULT_SAMPLE_INTERVAL;
+static __thread unsigned int sampleCountdown[LIST_OP_COUNT];
+
+static const char* operationNames[LIST_OP_COUNT] =
+{
+    "ListGetHeadData",
+    "ListGetTailData",
+    "ListGetNextData",
+    "ListGetPreviousData",
+    "ListAddHead",
+    "ListAddTail",
+    "ListAddBefore",
+    "ListAddAfter",
+    "ListRemoveHead",
+    "ListRemoveTail",
+    "ListRemove",
+    "ListClear",
+    "ListForEachParallel",
+    "ListReduceParallel",
+    "ListSnapshot",
+    "ListAdoptHead",
+    "ListAdoptTail",
+    "ListAdoptAfter",
+    "ListDetachHead",
+    "ListEmplaceHead",
+    "ListEmplaceTail",
+    "ListEmplaceAfterCursor",
+    "ListReserve",
+    "ListGetAt",
+    "ListInsertAt",
+    "ListRemoveAt",
+    "ListMoveToHead",
+    "ListMoveToTail",
+    "ListToArray",
+    "ListCopyInto",
+    "ListCopyRangeInto",
+};
+
+#ifdef LIST_LATENCY_USE_RDTSC
+/* Nanoseconds per tick in 16.16 fixed point, calibrated on first use. */
+static unsigned long long nanosecondsPerTickQ16;
+#endif
+
+static unsigned long long MonotonicNanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+#ifdef LIST_LATENCY_USE_RDTSC
+/**
+ * @brief Measures the TSC frequency against the monotonic clock over roughly one millisecond.
+ */
+static unsigned long long CalibrateTicks(void)
+{
+    unsigned long long startNanoseconds = MonotonicNanoseconds();
+    unsigned long long startTicks = __rdtsc();
+    unsigned long long elapsedNanoseconds = 0;
+
+    while (elapsedNanoseconds < 1000000ULL)
+    {
+        elapsedNanoseconds = MonotonicNanoseconds() - startNanoseconds;
+    }
+
+    unsigned long long elapsedTicks = __rdtsc() - startTicks;
+
+    if (elapsedTicks == 0)
+    {
+        return 1ULL << 16;
+    }
+
+    return (elapsedNanoseconds << 16) / elapsedTicks;
+}
+#endif
+
+static unsigned long long ReadClock(void)
+{
+#ifdef LIST_LATENCY_USE_RDTSC
+    return __rdtsc();
+#else
+    return MonotonicNanoseconds();
+#endif
+}
+
+static unsigned long long ClockToNanoseconds(unsigned long long elapsed)
+{
+#ifdef LIST_LATENCY_USE_RDTSC
+    unsigned long long scale = __atomic_load_n(&nanosecondsPerTickQ16, __ATOMIC_RELAXED);
+
+    if (scale == 0)
+    {
+        scale = CalibrateTicks();
+        __atomic_store_n(&nanosecondsPerTickQ16, scale, __ATOMIC_RELAXED);
+    }
+
+    return (elapsed * scale) >> 16;
+#else
+    return elapsed;
+#endif
+}
+
+/**
+ * @brief Maps a duration to its histogram bucket: exact below 16, then 16 sub-buckets per power of two.
+ */
+static int BucketIndex(unsigned long long value)
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return (int)value;
+    }
+
+    int msb = 63 - __builtin_clzll(value);
+    int subBucket = (int)((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+
+    return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+/**
+ * @brief Returns the highest duration that maps to the given bucket.
+ */
+static unsigned long long BucketHighestValue(int index)
+{
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return (unsigned long long)index;
+    }
+
+    int shift = index / SUB_BUCKET_COUNT - 1;
+    unsigned long long subBucket = (unsigned long long)(index % SUB_BUCKET_COUNT);
+
+    return ((SUB_BUCKET_COUNT + subBucket + 1) << shift) - 1;
+}
+
+static unsigned long long Percentile(ListOperation operation, unsigned long long samples, double percentile)
+{
+    unsigned long long rank = (unsigned long long)(percentile * (double)samples);
+    unsigned long long cumulative = 0;
+
+    if ((double)rank < percentile * (double)samples || rank == 0)
+    {
+        rank++;
+    }
+
+    for (int index = 0; index < BUCKET_COUNT; index++)
+    {
+        cumulative += histogram[operation][index];
+
+        if (cumulative >= rank)
+        {
+            unsigned long long value = BucketHighestValue(index);
+            return value < maximum[operation] ? value : maximum[operation];
+        }
+    }
+
+    return maximum[operation];
+}
+
+/**
+ * @brief Sets how many calls of each operation pass per timed call, per thread.
+ *
+ * @param The sample interval; 1 times every call.
+ * @return Error code indicating the success of the operation.
+ */
+int ListLatencySetSampleInterval(unsigned int interval)
+{
+    if (interval == 0)
+    {
+        return -1;
+    }
+
+    __atomic_store_n(&sampleInterval, interval, __ATOMIC_RELAXED);
+
+    for (int operation = 0; operation < LIST_OP_COUNT; operation++)
+    {
+        sampleCountdown[operation] = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the current sample interval.
+ *
+ * @return The number of calls per timed call.
+ */
+unsigned int ListLatencyGetSampleInterval(void)
+{
+    return __atomic_load_n(&sampleInterval, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Discards all recorded samples. Must not race with instrumented list calls.
+ */
+void ListLatencyReset(void)
+{
+    memset(histogram, 0, sizeof(histogram));
+    memset(maximum, 0, sizeof(maximum));
+}
+
+/**
+ * @brief Records one measured duration for an operation.
+ *
+ * @param The operation the duration belongs to.
+ * @param The duration in nanoseconds.
+ */
+void ListLatencyRecord(ListOperation operation, unsigned long long nanoseconds)
+{
+    if ((int)operation < 0 || operation >= LIST_OP_COUNT)
+    {
+        return;
+    }
+
+    __atomic_fetch_add(&histogram[operation][BucketIndex(nanoseconds)], 1ULL, __ATOMIC_RELAXED);
+
+    unsigned long long currentMaximum = __atomic_load_n(&maximum[operation], __ATOMIC_RELAXED);
+
+    while (nanoseconds > currentMaximum &&
+           !__atomic_compare_exchange_n(&maximum[operation], &currentMaximum, nanoseconds,
+                                        1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+/**
+ * @brief Computes the sample count, p50, p99, p99.9 and maximum of an operation.
+ *
+ * @param The operation to summarise.
+ * @param Pointer to the summary to be filled, in nanoseconds.
+ * @return Error code indicating the success of the operation.
+ */
+int ListLatencyGetSummary(ListOperation operation, ListLatencySummary* summary)
+{
+    if ((int)operation < 0 || operation >= LIST_OP_COUNT || summary == NULL)
+    {
+        return -1;
+    }
+
+    memset(summary, 0, sizeof(ListLatencySummary));
+
+    for (int index = 0; index < BUCKET_COUNT; index++)
+    {
+        summary->samples += histogram[operation][index];
+    }
+
+    if (summary->samples == 0)
+    {
+        return 0;
+    }
+
+    summary->p50 = Percentile(operation, summary->samples, 0.50);
+    summary->p99 = Percentile(operation, summary->samples, 0.99);
+    summary->p999 = Percentile(operation, summary->samples, 0.999);
+    summary->max = maximum[operation];
+
+    return 0;
+}
+
+/**
+ * @brief Prints p50/p99/p99.9/max of every sampled operation as a text table or as JSON.
+ *
+ * @param The stream to print to.
+ * @param The output format.
+ * @return Error code indicating the success of the operation.
+ */
+int ListLatencyDump(FILE* stream, ListLatencyFormat format)
+{
+    if (stream == NULL || (format != LIST_LATENCY_TEXT && format != LIST_LATENCY_JSON))
+    {
+        return -1;
+    }
+
+    int first = 1;
+
+    if (format == LIST_LATENCY_TEXT)
+    {
+        fprintf(stream, "%-20s %12s %12s %12s %12s %12s\n",
+                "operation", "samples", "p50(ns)", "p99(ns)", "p999(ns)", "max(ns)");
+    }
+    else
+    {
+        fprintf(stream, "{\"sampleInterval\":%u,\"operations\":[", ListLatencyGetSampleInterval());
+    }
+
+    for (int operation = 0; operation < LIST_OP_COUNT; operation++)
+    {
+        ListLatencySummary summary;
+        ListLatencyGetSummary((ListOperation)operation, &summary);
+
+        if (summary.samples == 0)
+        {
+            continue;
+        }
+
+        if (format == LIST_LATENCY_TEXT)
+        {
+            fprintf(stream, "%-20s %12llu %12llu %12llu %12llu %12llu\n", operationNames[operation],
+                    summary.samples, summary.p50, summary.p99, summary.p999, summary.max);
+        }
+        else
+        {
+            fprintf(stream, "%s{\"name\":\"%s\",\"samples\":%llu,\"p50\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu}",
+                    first ? "" : ",", operationNames[operation],
+                    summary.samples, summary.p50, summary.p99, summary.p999, summary.max);
+        }
+
+        first = 0;
+    }
+
+    if (format == LIST_LATENCY_JSON)
+    {
+        fprintf(stream, "]}\n");
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the public function name of an operation.
+ *
+ * @param The operation.
+ * @return The function name, or NULL for an unknown operation.
+ */
+const char* ListLatencyOperationName(ListOperation operation)
+{
+    if ((int)operation < 0 || operation >= LIST_OP_COUNT)
+    {
+        return NULL;
+    }
+
+    return operationNames[operation];
+}
+
+/**
+ * @brief Starts a latency sample if this call is due to be timed on the calling thread.
+ *
+ * Every operation counts down on its own, so interleaved operations are each
+ * timed once per sample interval instead of sharing the samples unevenly.
+ */
+ListLatencySample ListLatencyBegin(ListOperation operation)
+{
+    ListLatencySample sample = {operation, 0, 0};
+
+    if (sampleCountdown[operation] > 1)
+    {
+        sampleCountdown[operation]--;
+        return sample;
+    }
+
+    sampleCountdown[operation] = ListLatencyGetSampleInterval();
+    sample.sampled = 1;
+    sample.start = ReadClock();
+
+    return sample;
+}
+
+/**
+ * @brief Completes a latency sample started by ListLatencyBegin.
+ */
+void ListLatencyEnd(ListLatencySample* sample)
+{
+    if (sample == NULL || !sample->sampled)
+    {
+        return;
+    }
+
+    unsigned long long elapsed = ReadClock() - sample->start;
+    ListLatencyRecord(sample->operation, ClockToNanoseconds(elapsed));
+}
@@ -0,0 +1,77 @@
+/**
+ * @file list_latency.h
+ * @author Manuel Haulez
+ * @brief Sampled per-operation latency histograms for the linked list
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * When the library is built with -DLIST_LATENCY every public list function
+ * times one in every N calls (the sample interval) and records the duration
+ * in a log-bucketed histogram kept per operation. Buckets have 16 linear
+ * sub-buckets per power of two, so reported values are within ~6% of the
+ * measured ones. Durations are measured with clock_gettime(CLOCK_MONOTONIC),
+ * or with rdtsc when additionally built with -DLIST_LATENCY_RDTSC on x86-64.
+ */
+
+#ifndef LIST_LATENCY_H
+#define LIST_LATENCY_H
+
+#include <stdio.h>
+#include "linked_list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LIST_LATENCY_DEFAULT_SAMPLE_INTERVAL 64
+
+typedef enum
+{
+    LIST_LATENCY_TEXT,
+    LIST_LATENCY_JSON
+} ListLatencyFormat;
+
+typedef struct list_latency_summary ListLatencySummary;
+struct list_latency_summary
+{
+    unsigned long long samples;
+    unsigned long long p50;
+    unsigned long long p99;
+    unsigned long long p999;
+    unsigned long long max;
+};
+
+typedef struct list_latency_sample ListLatencySample;
+struct list_latency_sample
+{
+    ListOperation operation;
+    unsigned long long start;
+    int sampled;
+};
+
+int ListLatencySetSampleInterval(unsigned int interval);
+unsigned int ListLatencyGetSampleInterval(void);
+void ListLatencyReset(void);
+
+void ListLatencyRecord(ListOperation operation, unsigned long long nanoseconds);
+int ListLatencyGetSummary(ListOperation operation, ListLatencySummary* summary);
+int ListLatencyDump(FILE* stream, ListLatencyFormat format);
+const char* ListLatencyOperationName(ListOperation operation);
+
+ListLatencySample ListLatencyBegin(ListOperation operation);
+void ListLatencyEnd(ListLatencySample* sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef LIST_LATENCY
+#define LIST_LATENCY_SCOPE(operation) \
+    ListLatencySample latencySample __attribute__((cleanup(ListLatencyEnd))) = ListLatencyBegin(operation)
+#else
+#define LIST_LATENCY_SCOPE(operation)
+#endif
+
+#endif
@@ -0,0 +1,447 @@
+/**
+ * @file lru_cache.c
+ * @author Manuel Haulez
+ * @brief Fixed-capacity least-recently-used cache
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The hash table has a power-of-two bucket count of at least the capacity,
+ * so chains stay short without ever rehashing. Unused entries are kept on a
+ * free list threaded through the recency links.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lru_cache.h"
+
+#define PAYLOAD_ALIGNMENT 16
+
+typedef struct lru_entry LruEntry;
+struct lru_entry
+{
+    LruEntry* prev;
+    LruEntry* next;
+    LruEntry* chainNext;
+    size_t hash;
+};
+
+struct lru_cache
+{
+    LruEntry** buckets;
+    size_t bucketMask;
+    unsigned char* entries;
+    size_t entrySize;
+    size_t valueOffset;
+    LruEntry* head;
+    LruEntry* tail;
+    LruEntry* freeEntries;
+    size_t size;
+    size_t capacity;
+    int keySize;
+    int valueSize;
+    LruEvictFunction onEvict;
+    void* context;
+};
+
+static size_t AlignUp(size_t value)
+{
+    return (value + PAYLOAD_ALIGNMENT - 1) & ~(size_t)(PAYLOAD_ALIGNMENT - 1);
+}
+
+/**
+ * @brief 64-bit FNV-1a over the key bytes.
+ */
+static size_t HashKey(const void* key, int keySize)
+{
+    const unsigned char* bytes = key;
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (int index = 0; index < keySize; index++)
+    {
+        hash ^= bytes[index];
+        hash *= 1099511628211ULL;
+    }
+
+    return (size_t)(hash ^ (hash >> 32));
+}
+
+static void* EntryKey(LruEntry* entry)
+{
+    return (unsigned char*)entry + AlignUp(sizeof(LruEntry));
+}
+
+static void* EntryValue(LruCache* this, LruEntry* entry)
+{
+    return (unsigned char*)entry + this->valueOffset;
+}
+
+static LruEntry* FindEntry(LruCache* this, const void* key, size_t hash)
+{
+    LruEntry* entry = this->buckets[hash & this->bucketMask];
+
+    while (entry != NULL && (entry->hash != hash || memcmp(EntryKey(entry), key, this->keySize) != 0))
+    {
+        entry = entry->chainNext;
+    }
+
+    return entry;
+}
+
+static void UnlinkRecency(LruCache* this, LruEntry* entry)
+{
+    if (entry->prev != NULL)
+    {
+        entry->prev->next = entry->next;
+    }
+    else
+    {
+        this->head = entry->next;
+    }
+
+    if (entry->next != NULL)
+    {
+        entry->next->prev = entry->prev;
+    }
+    else
+    {
+        this->tail = entry->prev;
+    }
+}
+
+static void LinkRecencyHead(LruCache* this, LruEntry* entry)
+{
+    entry->prev = NULL;
+    entry->next = this->head;
+
+    if (this->head != NULL)
+    {
+        this->head->prev = entry;
+    }
+    else
+    {
+        this->tail = entry;
+    }
+
+    this->head = entry;
+}
+
+static void MoveToHead(LruCache* this, LruEntry* entry)
+{
+    if (this->head != entry)
+    {
+        UnlinkRecency(this, entry);
+        LinkRecencyHead(this, entry);
+    }
+}
+
+static void UnlinkChain(LruCache* this, LruEntry* entry)
+{
+    LruEntry** link = &this->buckets[entry->hash & this->bucketMask];
+
+    while (*link != entry)
+    {
+        link = &(*link)->chainNext;
+    }
+
+    *link = entry->chainNext;
+}
+
+/**
+ * @brief Removes an entry from both structures and returns it to the free list.
+ */
+static void ReleaseEntry(LruCache* this, LruEntry* entry)
+{
+    UnlinkChain(this, entry);
+    UnlinkRecency(this, entry);
+    entry->next = this->freeEntries;
+    this->freeEntries = entry;
+    this->size--;
+}
+
+static void ResetEntries(LruCache* this)
+{
+    memset(this->buckets, 0, sizeof(LruEntry*) * (this->bucketMask + 1));
+    this->head = NULL;
+    this->tail = NULL;
+    this->freeEntries = NULL;
+    this->size = 0;
+
+    for (size_t index = this->capacity; index > 0; index--)
+    {
+        LruEntry* entry = (LruEntry*)(this->entries + (index - 1) * this->entrySize);
+        entry->next = this->freeEntries;
+        this->freeEntries = entry;
+    }
+}
+
+/**
+ * @brief Creates an LRU cache.
+ *
+ * @param Size of a key in bytes.
+ * @param Size of a value in bytes.
+ * @param Maximum number of entries.
+ * @param Function called for evicted entries, or NULL.
+ * @param Context pointer passed through to onEvict.
+ * @return Pointer to the new cache, or NULL on failure.
+ */
+LruCache* LruCacheConstruct(int keySize, int valueSize, size_t capacity,
+                            LruEvictFunction onEvict, void* context)
+{
+    if (keySize <= 0 || valueSize < 0 || capacity == 0)
+    {
+        return NULL;
+    }
+
+    LruCache* this = malloc(sizeof(LruCache));
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    memset(this, 0, sizeof(LruCache));
+
+    size_t bucketCount = 1;
+
+    while (bucketCount < capacity)
+    {
+        bucketCount <<= 1;
+    }
+
+    this->keySize = keySize;
+    this->valueSize = valueSize;
+    this->capacity = capacity;
+    this->onEvict = onEvict;
+    this->context = context;
+    this->bucketMask = bucketCount - 1;
+    this->valueOffset = AlignUp(sizeof(LruEntry)) + AlignUp((size_t)keySize);
+    this->entrySize = this->valueOffset + AlignUp((size_t)valueSize);
+    this->buckets = malloc(sizeof(LruEntry*) * bucketCount);
+    this->entries = malloc(this->entrySize * capacity);
+
+    if (this->buckets == NULL || this->entries == NULL)
+    {
+        free(this->buckets);
+        free(this->entries);
+        free(this);
+        return NULL;
+    }
+
+    ResetEntries(this);
+
+    return this;
+}
+
+/**
+ * @brief Frees the cache with all its entries.
+ *
+ * @param Double pointer to the cache.
+ * @return Error code indicating the success of the operation.
+ */
+int LruCacheDestruct(LruCache** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    free((*this)->buckets);
+    free((*this)->entries);
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Looks up a key and marks it as most recently used.
+ *
+ * @param Cache pointer.
+ * @param Pointer to the key.
+ * @return Pointer to the cached value, or NULL on a miss. Valid until the entry is evicted or removed.
+ */
+void* LruCacheGet(LruCache* this, const void* key)
+{
+    if (this == NULL || key == NULL)
+    {
+        return NULL;
+    }
+
+    LruEntry* entry = FindEntry(this, key, HashKey(key, this->keySize));
+
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+
+    MoveToHead(this, entry);
+
+    return EntryValue(this, entry);
+}
+
+/**
+ * @brief Looks up a key without changing its recency.
+ *
+ * @param Cache pointer.
+ * @param Pointer to the key.
+ * @return Pointer to the cached value, or NULL on a miss.
+ */
+void* LruCachePeek(LruCache* this, const void* key)
+{
+    if (this == NULL || key == NULL)
+    {
+        return NULL;
+    }
+
+    LruEntry* entry = FindEntry(this, key, HashKey(key, this->keySize));
+
+    return entry != NULL ? EntryValue(this, entry) : NULL;
+}
+
+/**
+ * @brief Inserts or replaces the value of a key and marks it as most recently used.
+ *        Evicts the least recently used entry when the cache is full.
+ *
+ * @param Cache pointer.
+ * @param Pointer to the key.
+ * @param Pointer to the value; may be NULL only if the value size is zero.
+ * @return Error code indicating the success of the operation.
+ */
+int LruCachePut(LruCache* this, const void* key, const void* value)
+{
+    if (this == NULL || key == NULL || (value == NULL && this->valueSize > 0))
+    {
+        return -1;
+    }
+
+    size_t hash = HashKey(key, this->keySize);
+    LruEntry* entry = FindEntry(this, key, hash);
+
+    if (entry == NULL)
+    {
+        if (this->freeEntries == NULL)
+        {
+            LruCacheEvict(this);
+        }
+
+        entry = this->freeEntries;
+        this->freeEntries = entry->next;
+        entry->hash = hash;
+        memcpy(EntryKey(entry), key, this->keySize);
+        entry->chainNext = this->buckets[hash & this->bucketMask];
+        this->buckets[hash & this->bucketMask] = entry;
+        LinkRecencyHead(this, entry);
+        this->size++;
+    }
+    else
+    {
+        MoveToHead(this, entry);
+    }
+
+    if (this->valueSize > 0)
+    {
+        memcpy(EntryValue(this, entry), value, this->valueSize);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Marks a key as most recently used.
+ *
+ * @param Cache pointer.
+ * @param Pointer to the key.
+ * @return Error code indicating the success of the operation; -1 if the key is not cached.
+ */
+int LruCacheTouch(LruCache* this, const void* key)
+{
+    return LruCacheGet(this, key) != NULL ? 0 : -1;
+}
+
+/**
+ * @brief Evicts the least recently used entry, calling the eviction callback.
+ *
+ * @param Cache pointer.
+ * @return Error code indicating the success of the operation; -1 if the cache is empty.
+ */
+int LruCacheEvict(LruCache* this)
+{
+    if (this == NULL || this->tail == NULL)
+    {
+        return -1;
+    }
+
+    LruEntry* entry = this->tail;
+
+    if (this->onEvict != NULL)
+    {
+        this->onEvict(EntryKey(entry), EntryValue(this, entry), this->context);
+    }
+
+    ReleaseEntry(this, entry);
+
+    return 0;
+}
+
+/**
+ * @brief Removes a key without calling the eviction callback.
+ *
+ * @param Cache pointer.
+ * @param Pointer to the key.
+ * @return Error code indicating the success of the operation; -1 if the key is not cached.
+ */
+int LruCacheRemove(LruCache* this, const void* key)
+{
+    if (this == NULL || key == NULL)
+    {
+        return -1;
+    }
+
+    LruEntry* entry = FindEntry(this, key, HashKey(key, this->keySize));
+
+    if (entry == NULL)
+    {
+        return -1;
+    }
+
+    ReleaseEntry(this, entry);
+
+    return 0;
+}
+
+/**
+ * @brief Removes all entries without calling the eviction callback.
+ *
+ * @param Cache pointer.
+ * @return Error code indicating the success of the operation.
+ */
+int LruCacheClear(LruCache* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    ResetEntries(this);
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the number of cached entries.
+ */
+size_t LruCacheGetSize(LruCache* this)
+{
+    return this != NULL ? this->size : 0;
+}
+
+/**
+ * @brief Retrieves the maximum number of entries.
+ */
+size_t LruCacheGetCapacity(LruCache* this)
+{
+    return this != NULL ? this->capacity : 0;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file lru_cache.h
+ * @author Manuel Haulez
+ * @brief Fixed-capacity least-recently-used cache
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Keys and values are copied into the cache, like the data of a List, and
+ * compared bytewise. Every entry sits both in a hash chain and in a doubly
+ * linked recency list, so lookup, insert, touch and eviction are O(1). All
+ * entries are allocated up front for the full capacity.
+ */
+
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct lru_cache LruCache;
+
+/**
+ * Called with the key and value of an entry just before it is evicted to
+ * make room, or evicted with LruCacheEvict. Not called by LruCacheRemove,
+ * LruCacheClear or LruCacheDestruct.
+ */
+typedef void (*LruEvictFunction)(const void* key, void* value, void* context);
+
+LruCache* LruCacheConstruct(int keySize, int valueSize, size_t capacity,
+                            LruEvictFunction onEvict, void* context);
+int LruCacheDestruct(LruCache**);
+
+void* LruCacheGet(LruCache*, const void* key);
+void* LruCachePeek(LruCache*, const void* key);
+int LruCachePut(LruCache*, const void* key, const void* value);
+int LruCacheTouch(LruCache*, const void* key);
+
+int LruCacheEvict(LruCache*);
+int LruCacheRemove(LruCache*, const void* key);
+int LruCacheClear(LruCache*);
+
+size_t LruCacheGetSize(LruCache*);
+size_t LruCacheGetCapacity(LruCache*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
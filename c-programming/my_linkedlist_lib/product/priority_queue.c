@@ -0,0 +1,452 @@
+/**
+ * @file priority_queue.c
+ * @author Manuel Haulez
+ * @brief Contiguous d-ary heap priority queue
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Sifting moves a hole instead of swapping: the element being placed waits in
+ * a scratch buffer while the elements it passes are shifted by one level, so
+ * every step copies one element rather than three. Handles are indices into
+ * a position table; released handles are chained through that same table
+ * and reused.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "priority_queue.h"
+
+#define MINIMUM_CAPACITY 16
+#define MAXIMUM_ARITY 64
+#define NO_HANDLE ((size_t)-1)
+
+struct priority_queue
+{
+    unsigned char* elements;
+    size_t* heapHandles;
+    size_t* positions;
+    unsigned char* scratch;
+    size_t size;
+    size_t capacity;
+    size_t handleCount;
+    size_t freeHandle;
+    size_t dataSize;
+    int arity;
+    PriorityQueueCompareFunction compare;
+    void* context;
+};
+
+static void* Element(PriorityQueue* this, size_t position)
+{
+    return this->elements + position * this->dataSize;
+}
+
+static void Place(PriorityQueue* this, size_t position, const void* data, size_t handle)
+{
+    memcpy(Element(this, position), data, this->dataSize);
+    this->heapHandles[position] = handle;
+    this->positions[handle] = position;
+}
+
+/**
+ * @brief Moves the scratch element up from position until its parent is not greater.
+ */
+static void SiftUp(PriorityQueue* this, size_t position, size_t handle)
+{
+    while (position > 0)
+    {
+        size_t parent = (position - 1) / (size_t)this->arity;
+
+        if (this->compare(this->scratch, Element(this, parent), this->context) >= 0)
+        {
+            break;
+        }
+
+        Place(this, position, Element(this, parent), this->heapHandles[parent]);
+        position = parent;
+    }
+
+    Place(this, position, this->scratch, handle);
+}
+
+/**
+ * @brief Moves the scratch element down from position until no child is smaller.
+ */
+static void SiftDown(PriorityQueue* this, size_t position, size_t handle)
+{
+    for (;;)
+    {
+        size_t first = position * (size_t)this->arity + 1;
+
+        if (first >= this->size)
+        {
+            break;
+        }
+
+        size_t last = first + (size_t)this->arity;
+        size_t best = first;
+
+        last = last < this->size ? last : this->size;
+
+        for (size_t child = first + 1; child < last; child++)
+        {
+            if (this->compare(Element(this, child), Element(this, best), this->context) < 0)
+            {
+                best = child;
+            }
+        }
+
+        if (this->compare(Element(this, best), this->scratch, this->context) >= 0)
+        {
+            break;
+        }
+
+        Place(this, position, Element(this, best), this->heapHandles[best]);
+        position = best;
+    }
+
+    Place(this, position, this->scratch, handle);
+}
+
+static int Reserve(PriorityQueue* this, size_t capacity)
+{
+    if (capacity <= this->capacity)
+    {
+        return 0;
+    }
+
+    unsigned char* elements = realloc(this->elements, capacity * this->dataSize);
+
+    if (elements == NULL)
+    {
+        return -1;
+    }
+
+    this->elements = elements;
+
+    size_t* heapHandles = realloc(this->heapHandles, capacity * sizeof(size_t));
+
+    if (heapHandles == NULL)
+    {
+        return -1;
+    }
+
+    this->heapHandles = heapHandles;
+
+    size_t* positions = realloc(this->positions, capacity * sizeof(size_t));
+
+    if (positions == NULL)
+    {
+        return -1;
+    }
+
+    this->positions = positions;
+    this->capacity = capacity;
+
+    return 0;
+}
+
+static size_t AcquireHandle(PriorityQueue* this)
+{
+    if (this->freeHandle != NO_HANDLE)
+    {
+        size_t handle = this->freeHandle;
+        this->freeHandle = this->positions[handle];
+        return handle;
+    }
+
+    return this->handleCount++;
+}
+
+static void ReleaseHandle(PriorityQueue* this, size_t handle)
+{
+    this->positions[handle] = this->freeHandle;
+    this->freeHandle = handle;
+}
+
+static int IsLiveHandle(PriorityQueue* this, PriorityQueueHandle handle)
+{
+    return handle < this->handleCount && this->positions[handle] < this->size &&
+           this->heapHandles[this->positions[handle]] == handle;
+}
+
+/**
+ * @brief Creates an empty priority queue.
+ *
+ * @param Size of an element in bytes.
+ * @param Number of children per heap node, 2 to 64; 0 selects PRIORITY_QUEUE_DEFAULT_ARITY.
+ * @param Comparator ordering the elements.
+ * @param Context pointer passed through to compare.
+ * @return Pointer to the new priority queue, or NULL on failure.
+ */
+PriorityQueue* PriorityQueueConstruct(int dataSize, int arity, PriorityQueueCompareFunction compare, void* context)
+{
+    if (arity == 0)
+    {
+        arity = PRIORITY_QUEUE_DEFAULT_ARITY;
+    }
+
+    if (dataSize <= 0 || arity < 2 || arity > MAXIMUM_ARITY || compare == NULL)
+    {
+        return NULL;
+    }
+
+    PriorityQueue* this = malloc(sizeof(PriorityQueue));
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    memset(this, 0, sizeof(PriorityQueue));
+    this->dataSize = (size_t)dataSize;
+    this->arity = arity;
+    this->compare = compare;
+    this->context = context;
+    this->freeHandle = NO_HANDLE;
+    this->scratch = malloc(this->dataSize);
+
+    if (this->scratch == NULL || Reserve(this, MINIMUM_CAPACITY) == -1)
+    {
+        PriorityQueueDestruct(&this);
+        return NULL;
+    }
+
+    return this;
+}
+
+/**
+ * @brief Creates a priority queue holding a copy of an array, heapified in O(n).
+ *        The element at array index i gets handle i.
+ *
+ * @param Size of an element in bytes.
+ * @param Number of children per heap node, 2 to 64; 0 selects PRIORITY_QUEUE_DEFAULT_ARITY.
+ * @param Comparator ordering the elements.
+ * @param Context pointer passed through to compare.
+ * @param Pointer to the first element of the array.
+ * @param Number of elements in the array.
+ * @return Pointer to the new priority queue, or NULL on failure.
+ */
+PriorityQueue* PriorityQueueConstructFromArray(int dataSize, int arity, PriorityQueueCompareFunction compare,
+                                               void* context, const void* elements, size_t count)
+{
+    if (elements == NULL && count > 0)
+    {
+        return NULL;
+    }
+
+    PriorityQueue* this = PriorityQueueConstruct(dataSize, arity, compare, context);
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    if (Reserve(this, count) == -1)
+    {
+        PriorityQueueDestruct(&this);
+        return NULL;
+    }
+
+    if (count > 0)
+    {
+        memcpy(this->elements, elements, count * this->dataSize);
+    }
+
+    for (size_t position = 0; position < count; position++)
+    {
+        this->heapHandles[position] = position;
+        this->positions[position] = position;
+    }
+
+    this->size = count;
+    this->handleCount = count;
+
+    /* Sift down every node that has children, from the last one back to the root. */
+    for (size_t position = count > 1 ? (count - 2) / (size_t)this->arity + 1 : 0; position-- > 0;)
+    {
+        memcpy(this->scratch, Element(this, position), this->dataSize);
+        SiftDown(this, position, this->heapHandles[position]);
+    }
+
+    return this;
+}
+
+/**
+ * @brief Frees the priority queue with all its elements.
+ *
+ * @param Double pointer to the priority queue.
+ * @return Error code indicating the success of the operation.
+ */
+int PriorityQueueDestruct(PriorityQueue** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    free((*this)->elements);
+    free((*this)->heapHandles);
+    free((*this)->positions);
+    free((*this)->scratch);
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Adds a copy of an element.
+ *
+ * @param Priority queue pointer.
+ * @param Pointer to the element.
+ * @param Receives the element's handle; may be NULL.
+ * @return Error code indicating the success of the operation.
+ */
+int PriorityQueuePush(PriorityQueue* this, const void* data, PriorityQueueHandle* handle)
+{
+    if (this == NULL || data == NULL)
+    {
+        return -1;
+    }
+
+    if (this->size == this->capacity && Reserve(this, this->capacity * 2) == -1)
+    {
+        return -1;
+    }
+
+    size_t newHandle = AcquireHandle(this);
+
+    memcpy(this->scratch, data, this->dataSize);
+    this->size++;
+    SiftUp(this, this->size - 1, newHandle);
+
+    if (handle != NULL)
+    {
+        *handle = newHandle;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Removes the lowest element. Its handle becomes invalid.
+ *
+ * @param Priority queue pointer.
+ * @param Receives a copy of the removed element; may be NULL.
+ * @return Error code indicating the success of the operation; -1 if the queue is empty.
+ */
+int PriorityQueuePop(PriorityQueue* this, void* data)
+{
+    if (this == NULL || this->size == 0)
+    {
+        return -1;
+    }
+
+    if (data != NULL)
+    {
+        memcpy(data, Element(this, 0), this->dataSize);
+    }
+
+    ReleaseHandle(this, this->heapHandles[0]);
+    this->size--;
+
+    if (this->size > 0)
+    {
+        memcpy(this->scratch, Element(this, this->size), this->dataSize);
+        SiftDown(this, 0, this->heapHandles[this->size]);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the lowest element without removing it.
+ *
+ * @param Priority queue pointer.
+ * @return Pointer to the element, or NULL if the queue is empty. Valid until the queue is modified.
+ */
+void* PriorityQueuePeek(PriorityQueue* this)
+{
+    if (this == NULL || this->size == 0)
+    {
+        return NULL;
+    }
+
+    return Element(this, 0);
+}
+
+/**
+ * @brief Retrieves the element of a handle.
+ *
+ * @param Priority queue pointer.
+ * @param Handle returned by PriorityQueuePush.
+ * @return Pointer to the element, or NULL for an invalid handle. Valid until the queue is modified.
+ */
+void* PriorityQueueGetData(PriorityQueue* this, PriorityQueueHandle handle)
+{
+    if (this == NULL || !IsLiveHandle(this, handle))
+    {
+        return NULL;
+    }
+
+    return Element(this, this->positions[handle]);
+}
+
+/**
+ * @brief Replaces an element with one that compares lower or equal, moving it towards the top.
+ *
+ * @param Priority queue pointer.
+ * @param Handle of the element.
+ * @param Pointer to the replacement element.
+ * @return Error code indicating the success of the operation; -1 for an invalid handle or an increase.
+ */
+int PriorityQueueDecreaseKey(PriorityQueue* this, PriorityQueueHandle handle, const void* data)
+{
+    if (this == NULL || data == NULL || !IsLiveHandle(this, handle))
+    {
+        return -1;
+    }
+
+    size_t position = this->positions[handle];
+
+    if (this->compare(data, Element(this, position), this->context) > 0)
+    {
+        return -1;
+    }
+
+    memcpy(this->scratch, data, this->dataSize);
+    SiftUp(this, position, handle);
+
+    return 0;
+}
+
+/**
+ * @brief Removes all elements, invalidating every handle.
+ *
+ * @param Priority queue pointer.
+ * @return Error code indicating the success of the operation.
+ */
+int PriorityQueueClear(PriorityQueue* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    this->size = 0;
+    this->handleCount = 0;
+    this->freeHandle = NO_HANDLE;
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the number of queued elements.
+ */
+size_t PriorityQueueGetSize(PriorityQueue* this)
+{
+    return this != NULL ? this->size : 0;
+}
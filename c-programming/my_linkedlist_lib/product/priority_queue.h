@@ -0,0 +1,57 @@
+/**
+ * @file priority_queue.h
+ * @author Manuel Haulez
+ * @brief Contiguous d-ary heap priority queue
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Elements of dataSize bytes are copied into one array ordered as a d-ary
+ * heap by a caller supplied comparator; the element that compares lowest is
+ * popped first. A wider heap is shallower and scans its children within one
+ * or two cache lines, which usually beats the binary heap for pushes and
+ * decrease-key. Every element gets a handle that stays valid while the
+ * element is queued, so its priority can be raised in place.
+ */
+
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRIORITY_QUEUE_DEFAULT_ARITY 4
+
+typedef struct priority_queue PriorityQueue;
+typedef size_t PriorityQueueHandle;
+
+/**
+ * Returns a negative value if a must be popped before b, zero if they are
+ * equivalent and a positive value otherwise.
+ */
+typedef int (*PriorityQueueCompareFunction)(const void* a, const void* b, void* context);
+
+PriorityQueue* PriorityQueueConstruct(int dataSize, int arity, PriorityQueueCompareFunction compare, void* context);
+PriorityQueue* PriorityQueueConstructFromArray(int dataSize, int arity, PriorityQueueCompareFunction compare,
+                                               void* context, const void* elements, size_t count);
+int PriorityQueueDestruct(PriorityQueue**);
+
+int PriorityQueuePush(PriorityQueue*, const void* data, PriorityQueueHandle* handle);
+int PriorityQueuePop(PriorityQueue*, void* data);
+void* PriorityQueuePeek(PriorityQueue*);
+
+void* PriorityQueueGetData(PriorityQueue*, PriorityQueueHandle handle);
+int PriorityQueueDecreaseKey(PriorityQueue*, PriorityQueueHandle handle, const void* data);
+
+int PriorityQueueClear(PriorityQueue*);
+size_t PriorityQueueGetSize(PriorityQueue*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,262 @@
+/**
+ * @file slab_arena.c
+ * @author Manuel Haulez
+ * @brief Arena packing variable-sized blocks into shared slabs
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every block is preceded by a header naming its slab and its size. The
+ * arena bump-allocates from its current slab; a slab counts its live blocks
+ * and is freed when the count drops to zero, except for the current slab,
+ * which is rewound instead. Blocks larger than a slab get a slab of their own.
+ */
+
+#include <stdlib.h>
+#include "slab_arena.h"
+
+#define SLAB_ALIGNMENT 16
+#define SLAB_ALIGN_SIZE(size) (((size) + SLAB_ALIGNMENT - 1) & ~(size_t)(SLAB_ALIGNMENT - 1))
+
+typedef struct slab Slab;
+struct slab
+{
+    SlabArena* arena;
+    Slab* prev;
+    Slab* next;
+    size_t used;
+    size_t capacity;
+    size_t liveCount;
+};
+
+typedef struct block_header BlockHeader;
+struct block_header
+{
+    Slab* slab;
+    size_t size;
+};
+
+struct slab_arena
+{
+    Slab* current;
+    size_t slabSize;
+    size_t slabCount;
+};
+
+#define SLAB_HEADER_SIZE SLAB_ALIGN_SIZE(sizeof(Slab))
+#define BLOCK_HEADER_SIZE SLAB_ALIGN_SIZE(sizeof(BlockHeader))
+
+/**
+ * @brief Allocates a slab of the given capacity and links it after the current slab, or as the first one.
+ */
+static Slab* AddSlab(SlabArena* this, size_t capacity)
+{
+    Slab* slab = malloc(SLAB_HEADER_SIZE + capacity);
+
+    if (slab == NULL)
+    {
+        return NULL;
+    }
+
+    slab->arena = this;
+    slab->used = 0;
+    slab->capacity = capacity;
+    slab->liveCount = 0;
+    slab->prev = this->current;
+    slab->next = this->current != NULL ? this->current->next : NULL;
+
+    if (slab->next != NULL)
+    {
+        slab->next->prev = slab;
+    }
+
+    if (this->current != NULL)
+    {
+        this->current->next = slab;
+    }
+
+    this->slabCount++;
+
+    return slab;
+}
+
+/**
+ * @brief Unlinks and frees a slab that is not the current one.
+ */
+static void RemoveSlab(SlabArena* this, Slab* slab)
+{
+    if (slab->prev != NULL)
+    {
+        slab->prev->next = slab->next;
+    }
+
+    if (slab->next != NULL)
+    {
+        slab->next->prev = slab->prev;
+    }
+
+    this->slabCount--;
+    free(slab);
+}
+
+/**
+ * @brief Constructs an arena without slabs.
+ *
+ * @param Size of a regular slab in bytes.
+ * @return Pointer to the new arena, or NULL on failure.
+ */
+SlabArena* SlabArenaConstruct(size_t slabSize)
+{
+    if (slabSize == 0)
+    {
+        return NULL;
+    }
+
+    SlabArena* newArena = malloc(sizeof(SlabArena));
+
+    if (newArena == NULL)
+    {
+        return NULL;
+    }
+
+    newArena->current = NULL;
+    newArena->slabSize = SLAB_ALIGN_SIZE(slabSize);
+    newArena->slabCount = 0;
+
+    return newArena;
+}
+
+/**
+ * @brief Frees the arena and every slab, including blocks not released yet.
+ *
+ * @param Double pointer to the arena.
+ * @return Error code indicating the success of the operation.
+ */
+int SlabArenaDestruct(SlabArena** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    Slab* current = (*this)->current;
+
+    if (current != NULL)
+    {
+        for (Slab* slab = current->prev; slab != NULL;)
+        {
+            Slab* prev = slab->prev;
+            free(slab);
+            slab = prev;
+        }
+
+        for (Slab* slab = current; slab != NULL;)
+        {
+            Slab* next = slab->next;
+            free(slab);
+            slab = next;
+        }
+    }
+
+    free(*this);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Allocates a block from the arena.
+ *
+ * @param Arena pointer.
+ * @param Size of the block in bytes.
+ * @return Pointer to the block, aligned to 16 bytes, or NULL on failure.
+ */
+void* SlabArenaAllocate(SlabArena* this, size_t size)
+{
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    size_t blockSize = BLOCK_HEADER_SIZE + SLAB_ALIGN_SIZE(size);
+    Slab* slab = this->current;
+
+    if (blockSize > this->slabSize)
+    {
+        slab = AddSlab(this, blockSize);
+    }
+    else if (slab == NULL || slab->used + blockSize > slab->capacity)
+    {
+        slab = AddSlab(this, this->slabSize);
+
+        if (slab != NULL)
+        {
+            this->current = slab;
+        }
+    }
+
+    if (slab == NULL)
+    {
+        return NULL;
+    }
+
+    this->current = this->current != NULL ? this->current : slab;
+
+    BlockHeader* header = (BlockHeader*)((unsigned char*)slab + SLAB_HEADER_SIZE + slab->used);
+    header->slab = slab;
+    header->size = size;
+    slab->used += blockSize;
+    slab->liveCount++;
+
+    return (unsigned char*)header + BLOCK_HEADER_SIZE;
+}
+
+/**
+ * @brief Releases a block. Its slab is freed once all of its blocks are released.
+ *
+ * @param Block returned by SlabArenaAllocate, or NULL.
+ */
+void SlabArenaRelease(void* block)
+{
+    if (block == NULL)
+    {
+        return;
+    }
+
+    Slab* slab = ((BlockHeader*)((unsigned char*)block - BLOCK_HEADER_SIZE))->slab;
+
+    if (--slab->liveCount > 0)
+    {
+        return;
+    }
+
+    if (slab == slab->arena->current)
+    {
+        slab->used = 0;
+        return;
+    }
+
+    RemoveSlab(slab->arena, slab);
+}
+
+/**
+ * @brief Retrieves the size a block was allocated with.
+ */
+size_t SlabArenaGetSize(const void* block)
+{
+    if (block == NULL)
+    {
+        return 0;
+    }
+
+    return ((const BlockHeader*)((const unsigned char*)block - BLOCK_HEADER_SIZE))->size;
+}
+
+/**
+ * @brief Retrieves the number of slabs the arena currently holds.
+ */
+size_t SlabArenaGetSlabCount(SlabArena* this)
+{
+    return this != NULL ? this->slabCount : 0;
+}
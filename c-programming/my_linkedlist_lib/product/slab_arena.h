@@ -0,0 +1,39 @@
+/**
+ * @file slab_arena.h
+ * @author Manuel Haulez
+ * @brief Arena packing variable-sized blocks into shared slabs
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Blocks are carved from the current slab one after another and carry their
+ * size in front of them. A slab is only returned to the system once every
+ * block in it has been released, so the arena suits blocks with similar
+ * lifetimes, such as the elements of one list. The arena is not thread-safe.
+ */
+
+#ifndef SLAB_ARENA_H
+#define SLAB_ARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct slab_arena SlabArena;
+
+SlabArena* SlabArenaConstruct(size_t slabSize);
+int SlabArenaDestruct(SlabArena**);
+
+void* SlabArenaAllocate(SlabArena*, size_t size);
+void SlabArenaRelease(void* block);
+size_t SlabArenaGetSize(const void* block);
+size_t SlabArenaGetSlabCount(SlabArena*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
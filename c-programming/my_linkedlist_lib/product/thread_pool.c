@@ -0,0 +1,687 @@
+/**
+ * @file thread_pool.c
+ * @author Manuel Haulez
+ * @brief Work-stealing thread pool
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The deques follow "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013). A deque that runs
+ * full is copied into a buffer of twice the size; the old buffer may still
+ * be read by a concurrent thief, so it is only freed when the pool is
+ * destroyed.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "thread_pool.h"
+
+#define DEQUE_INITIAL_CAPACITY 256
+#define CACHE_LINE_SIZE 64
+
+typedef struct task Task;
+struct task
+{
+    ThreadPoolTaskFunction function;
+    void* argument;
+    ThreadPoolGroup* group;
+    Task* next;
+};
+
+typedef struct deque_buffer DequeBuffer;
+struct deque_buffer
+{
+    long capacity;
+    DequeBuffer* retired;
+    Task* slots[];
+};
+
+typedef struct worker Worker;
+struct worker
+{
+    long top __attribute__((aligned(CACHE_LINE_SIZE)));
+    long bottom __attribute__((aligned(CACHE_LINE_SIZE)));
+    DequeBuffer* buffer;
+    ThreadPool* pool;
+    pthread_t thread;
+    unsigned int seed;
+};
+
+struct thread_pool
+{
+    Worker* workers;
+    int threadCount;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    Task* injectedHead;
+    Task* injectedTail;
+    unsigned long injected;
+    unsigned long queued;
+    int sleeping;
+    int stopping;
+};
+
+static __thread Worker* currentWorker;
+static __thread unsigned int externalSeed;
+
+static ThreadPool* defaultPool;
+static pthread_once_t defaultPoolOnce = PTHREAD_ONCE_INIT;
+
+static DequeBuffer* CreateBuffer(long capacity)
+{
+    DequeBuffer* buffer = malloc(sizeof(DequeBuffer) + sizeof(Task*) * capacity);
+
+    if (buffer != NULL)
+    {
+        buffer->capacity = capacity;
+        buffer->retired = NULL;
+    }
+
+    return buffer;
+}
+
+/**
+ * @brief Pushes a task onto the bottom of the worker's own deque. Owner only.
+ *
+ * @return Error code indicating the success of the operation.
+ */
+static int PushTask(Worker* this, Task* task)
+{
+    long bottom = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED);
+    long top = __atomic_load_n(&this->top, __ATOMIC_ACQUIRE);
+    DequeBuffer* buffer = __atomic_load_n(&this->buffer, __ATOMIC_RELAXED);
+
+    if (bottom - top > buffer->capacity - 1)
+    {
+        DequeBuffer* grown = CreateBuffer(buffer->capacity * 2);
+
+        if (grown == NULL)
+        {
+            return -1;
+        }
+
+        for (long index = top; index < bottom; index++)
+        {
+            grown->slots[index & (grown->capacity - 1)] =
+                __atomic_load_n(&buffer->slots[index & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+        }
+
+        grown->retired = buffer;
+        __atomic_store_n(&this->buffer, grown, __ATOMIC_RELEASE);
+        buffer = grown;
+    }
+
+    __atomic_store_n(&buffer->slots[bottom & (buffer->capacity - 1)], task, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&this->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+/**
+ * @brief Pops the most recently pushed task from the worker's own deque. Owner only.
+ *
+ * @return The task, or NULL if the deque is empty.
+ */
+static Task* TakeTask(Worker* this)
+{
+    long bottom = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED) - 1;
+    DequeBuffer* buffer = __atomic_load_n(&this->buffer, __ATOMIC_RELAXED);
+    __atomic_store_n(&this->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long top = __atomic_load_n(&this->top, __ATOMIC_RELAXED);
+    Task* task = NULL;
+
+    if (top <= bottom)
+    {
+        task = __atomic_load_n(&buffer->slots[bottom & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+
+        if (top == bottom)
+        {
+            if (!__atomic_compare_exchange_n(&this->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+            {
+                task = NULL;
+            }
+
+            __atomic_store_n(&this->bottom, bottom + 1, __ATOMIC_RELAXED);
+        }
+    }
+    else
+    {
+        __atomic_store_n(&this->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    return task;
+}
+
+/**
+ * @brief Steals the oldest task from another worker's deque.
+ *
+ * @return The task, or NULL if the deque is empty or another thread won the race.
+ */
+static Task* StealTask(Worker* victim)
+{
+    long top = __atomic_load_n(&victim->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long bottom = __atomic_load_n(&victim->bottom, __ATOMIC_ACQUIRE);
+
+    if (top >= bottom)
+    {
+        return NULL;
+    }
+
+    DequeBuffer* buffer = __atomic_load_n(&victim->buffer, __ATOMIC_ACQUIRE);
+    Task* task = __atomic_load_n(&buffer->slots[top & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+
+    if (!__atomic_compare_exchange_n(&victim->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        return NULL;
+    }
+
+    return task;
+}
+
+static Task* TakeInjectedTask(ThreadPool* this)
+{
+    if (__atomic_load_n(&this->injected, __ATOMIC_RELAXED) == 0)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&this->lock);
+    Task* task = this->injectedHead;
+
+    if (task != NULL)
+    {
+        this->injectedHead = task->next;
+
+        if (this->injectedHead == NULL)
+        {
+            this->injectedTail = NULL;
+        }
+
+        __atomic_sub_fetch(&this->injected, 1, __ATOMIC_RELAXED);
+    }
+
+    pthread_mutex_unlock(&this->lock);
+
+    return task;
+}
+
+/**
+ * @brief Finds runnable work: the own deque first, then the injection queue, then a random victim.
+ *
+ * @return The task, or NULL if nothing was found.
+ */
+static Task* FindTask(ThreadPool* this, Worker* self)
+{
+    Task* task = self != NULL ? TakeTask(self) : NULL;
+
+    if (task == NULL)
+    {
+        task = TakeInjectedTask(this);
+    }
+
+    if (task == NULL && this->threadCount > 0)
+    {
+        unsigned int* seed = self != NULL ? &self->seed : &externalSeed;
+        *seed = *seed * 1103515245u + 12345u;
+        int start = (int)((*seed >> 16) % (unsigned int)this->threadCount);
+
+        for (int offset = 0; offset < this->threadCount && task == NULL; offset++)
+        {
+            Worker* victim = &this->workers[(start + offset) % this->threadCount];
+
+            if (victim != self)
+            {
+                task = StealTask(victim);
+            }
+        }
+    }
+
+    if (task != NULL)
+    {
+        __atomic_sub_fetch(&this->queued, 1, __ATOMIC_SEQ_CST);
+    }
+
+    return task;
+}
+
+static void RunTask(Task* task)
+{
+    ThreadPoolGroup* group = task->group;
+
+    task->function(task->argument);
+    free(task);
+
+    if (group != NULL)
+    {
+        __atomic_sub_fetch(&group->pending, 1, __ATOMIC_RELEASE);
+    }
+}
+
+static Worker* WorkerOf(ThreadPool* this)
+{
+    return currentWorker != NULL && currentWorker->pool == this ? currentWorker : NULL;
+}
+
+static void* WorkerMain(void* argument)
+{
+    Worker* self = argument;
+    ThreadPool* pool = self->pool;
+
+    currentWorker = self;
+
+    for (;;)
+    {
+        Task* task = FindTask(pool, self);
+
+        if (task != NULL)
+        {
+            RunTask(task);
+            continue;
+        }
+
+        if (__atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST) != 0)
+        {
+            sched_yield();
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        __atomic_add_fetch(&pool->sleeping, 1, __ATOMIC_SEQ_CST);
+
+        while (__atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST) == 0 && !pool->stopping)
+        {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+
+        __atomic_sub_fetch(&pool->sleeping, 1, __ATOMIC_SEQ_CST);
+        int stop = pool->stopping && __atomic_load_n(&pool->queued, __ATOMIC_SEQ_CST) == 0;
+        pthread_mutex_unlock(&pool->lock);
+
+        if (stop)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Stops and joins the first startedCount workers, then frees the pool and its deques.
+ */
+static void FreePool(ThreadPool* this, int startedCount)
+{
+    pthread_mutex_lock(&this->lock);
+    this->stopping = 1;
+    pthread_cond_broadcast(&this->wake);
+    pthread_mutex_unlock(&this->lock);
+
+    for (int index = 0; index < startedCount; index++)
+    {
+        pthread_join(this->workers[index].thread, NULL);
+    }
+
+    Task* task;
+
+    while ((task = TakeInjectedTask(this)) != NULL)
+    {
+        RunTask(task);
+    }
+
+    for (int index = 0; index < this->threadCount; index++)
+    {
+        DequeBuffer* buffer = this->workers[index].buffer;
+
+        while (buffer != NULL)
+        {
+            DequeBuffer* retired = buffer->retired;
+            free(buffer);
+            buffer = retired;
+        }
+    }
+
+    free(this->workers);
+    pthread_cond_destroy(&this->wake);
+    pthread_mutex_destroy(&this->lock);
+    free(this);
+}
+
+/**
+ * @brief Creates a thread pool and starts its workers.
+ *
+ * @param Number of worker threads; 0 starts one per online CPU.
+ * @return Pointer to the new thread pool, or NULL on failure.
+ */
+ThreadPool* ThreadPoolConstruct(int threadCount)
+{
+    if (threadCount <= 0)
+    {
+        long onlineCpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = onlineCpus > 0 ? (int)onlineCpus : 1;
+    }
+
+    ThreadPool* this = malloc(sizeof(ThreadPool));
+
+    if (this == NULL)
+    {
+        return NULL;
+    }
+
+    memset(this, 0, sizeof(ThreadPool));
+
+    void* workers = NULL;
+
+    if (posix_memalign(&workers, CACHE_LINE_SIZE, sizeof(Worker) * threadCount) != 0)
+    {
+        free(this);
+        return NULL;
+    }
+
+    memset(workers, 0, sizeof(Worker) * threadCount);
+    this->workers = workers;
+    pthread_mutex_init(&this->lock, NULL);
+    pthread_cond_init(&this->wake, NULL);
+
+    this->threadCount = threadCount;
+
+    for (int index = 0; index < threadCount; index++)
+    {
+        Worker* worker = &this->workers[index];
+        worker->pool = this;
+        worker->seed = (unsigned int)index * 2654435761u + 1u;
+        worker->buffer = CreateBuffer(DEQUE_INITIAL_CAPACITY);
+
+        if (worker->buffer == NULL)
+        {
+            FreePool(this, 0);
+            return NULL;
+        }
+    }
+
+    int startedCount = 0;
+
+    while (startedCount < threadCount &&
+           pthread_create(&this->workers[startedCount].thread, NULL, WorkerMain, &this->workers[startedCount]) == 0)
+    {
+        startedCount++;
+    }
+
+    if (startedCount < threadCount)
+    {
+        FreePool(this, startedCount);
+        return NULL;
+    }
+
+    return this;
+}
+
+/**
+ * @brief Runs all remaining tasks, stops the workers and frees the thread pool.
+ *
+ * @param Double pointer to the thread pool.
+ * @return Error code indicating the success of the operation.
+ */
+int ThreadPoolDestruct(ThreadPool** this)
+{
+    if (this == NULL || *this == NULL)
+    {
+        return -1;
+    }
+
+    FreePool(*this, (*this)->threadCount);
+    *this = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Retrieves the number of worker threads of the pool.
+ *
+ * @param Thread pool pointer.
+ * @return The worker count, or -1 if the pool is NULL.
+ */
+int ThreadPoolGetThreadCount(ThreadPool* this)
+{
+    if (this == NULL)
+    {
+        return -1;
+    }
+
+    return this->threadCount;
+}
+
+static void ConstructDefaultPool(void)
+{
+    defaultPool = ThreadPoolConstruct(0);
+}
+
+/**
+ * @brief Retrieves the process-wide pool with one worker per online CPU, created on first use.
+ *
+ * @return The default thread pool, or NULL if it could not be created.
+ */
+ThreadPool* ThreadPoolGetDefault(void)
+{
+    pthread_once(&defaultPoolOnce, ConstructDefaultPool);
+
+    return defaultPool;
+}
+
+/**
+ * @brief Prepares a group for tracking submitted tasks.
+ */
+void ThreadPoolGroupInit(ThreadPoolGroup* group)
+{
+    if (group != NULL)
+    {
+        group->pending = 0;
+    }
+}
+
+/**
+ * @brief Queues a task for execution on the pool.
+ *
+ * @param Thread pool pointer.
+ * @param Group that tracks the task, or NULL for a detached task.
+ * @param Function to run.
+ * @param Argument passed to the function.
+ * @return Error code indicating the success of the operation.
+ */
+int ThreadPoolSubmit(ThreadPool* this, ThreadPoolGroup* group, ThreadPoolTaskFunction function, void* argument)
+{
+    if (this == NULL || function == NULL)
+    {
+        return -1;
+    }
+
+    Task* task = malloc(sizeof(Task));
+
+    if (task == NULL)
+    {
+        return -1;
+    }
+
+    task->function = function;
+    task->argument = argument;
+    task->group = group;
+    task->next = NULL;
+
+    if (group != NULL)
+    {
+        __atomic_add_fetch(&group->pending, 1, __ATOMIC_RELAXED);
+    }
+
+    Worker* self = WorkerOf(this);
+
+    if (self != NULL)
+    {
+        if (PushTask(self, task) == -1)
+        {
+            if (group != NULL)
+            {
+                __atomic_sub_fetch(&group->pending, 1, __ATOMIC_RELAXED);
+            }
+
+            free(task);
+            return -1;
+        }
+    }
+    else
+    {
+        pthread_mutex_lock(&this->lock);
+
+        if (this->injectedTail != NULL)
+        {
+            this->injectedTail->next = task;
+        }
+        else
+        {
+            this->injectedHead = task;
+        }
+
+        this->injectedTail = task;
+        __atomic_add_fetch(&this->injected, 1, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&this->lock);
+    }
+
+    __atomic_add_fetch(&this->queued, 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&this->sleeping, __ATOMIC_SEQ_CST) > 0)
+    {
+        pthread_mutex_lock(&this->lock);
+        pthread_cond_signal(&this->wake);
+        pthread_mutex_unlock(&this->lock);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Returns once every task of the group has finished, running queued tasks meanwhile.
+ *
+ * @param Thread pool pointer.
+ * @param Group to wait for.
+ * @return Error code indicating the success of the operation.
+ */
+int ThreadPoolWait(ThreadPool* this, ThreadPoolGroup* group)
+{
+    if (this == NULL || group == NULL)
+    {
+        return -1;
+    }
+
+    Worker* self = WorkerOf(this);
+
+    while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE) != 0)
+    {
+        Task* task = FindTask(this, self);
+
+        if (task != NULL)
+        {
+            RunTask(task);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+typedef struct range_task RangeTask;
+struct range_task
+{
+    ThreadPool* pool;
+    ThreadPoolGroup* group;
+    size_t begin;
+    size_t end;
+    size_t grain;
+    ThreadPoolRangeFunction function;
+    void* context;
+};
+
+static void RunQueuedRange(void* argument);
+
+/**
+ * @brief Splits the range in halves, queueing every right half, until at most grain indices remain.
+ */
+static void RunRange(RangeTask* range)
+{
+    size_t begin = range->begin;
+    size_t end = range->end;
+
+    while (end - begin > range->grain)
+    {
+        size_t middle = begin + (end - begin) / 2;
+        RangeTask* right = malloc(sizeof(RangeTask));
+
+        if (right == NULL)
+        {
+            break;
+        }
+
+        *right = *range;
+        right->begin = middle;
+        right->end = end;
+
+        if (ThreadPoolSubmit(range->pool, range->group, RunQueuedRange, right) == -1)
+        {
+            free(right);
+            break;
+        }
+
+        end = middle;
+    }
+
+    range->function(begin, end, range->context);
+}
+
+static void RunQueuedRange(void* argument)
+{
+    RunRange(argument);
+    free(argument);
+}
+
+/**
+ * @brief Calls function on disjoint subranges of [begin, end) in parallel and waits for all of them.
+ *
+ * @param Thread pool pointer.
+ * @param First index of the range.
+ * @param One past the last index of the range.
+ * @param Largest subrange handed to one call; 0 is treated as 1.
+ * @param Function called with each subrange and the context.
+ * @param Context pointer passed through to function.
+ * @return Error code indicating the success of the operation.
+ */
+int ThreadPoolParallelFor(ThreadPool* this, size_t begin, size_t end, size_t grain,
+                          ThreadPoolRangeFunction function, void* context)
+{
+    if (this == NULL || function == NULL || begin > end)
+    {
+        return -1;
+    }
+
+    if (begin == end)
+    {
+        return 0;
+    }
+
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+
+    RangeTask range = {this, &group, begin, end, grain == 0 ? 1 : grain, function, context};
+    RunRange(&range);
+
+    return ThreadPoolWait(this, &group);
+}
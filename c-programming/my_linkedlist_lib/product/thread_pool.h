@@ -0,0 +1,58 @@
+/**
+ * @file thread_pool.h
+ * @author Manuel Haulez
+ * @brief Work-stealing thread pool
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every worker owns a Chase-Lev deque. Tasks submitted from a worker are
+ * pushed onto its own deque and popped LIFO by that worker, idle workers steal
+ * FIFO from the other end. Tasks submitted from outside the pool go through a
+ * shared injection queue. Waiting on a group runs queued tasks instead of
+ * blocking, so tasks may themselves submit and wait on nested work.
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct thread_pool ThreadPool;
+
+typedef void (*ThreadPoolTaskFunction)(void* argument);
+typedef void (*ThreadPoolRangeFunction)(size_t begin, size_t end, void* context);
+
+/**
+ * Tracks the completion of a set of submitted tasks. Lives wherever the
+ * submitter likes, usually on its stack, and must be initialised with
+ * ThreadPoolGroupInit before the first submit.
+ */
+typedef struct thread_pool_group ThreadPoolGroup;
+struct thread_pool_group
+{
+    unsigned long pending;
+};
+
+ThreadPool* ThreadPoolConstruct(int threadCount);
+int ThreadPoolDestruct(ThreadPool**);
+int ThreadPoolGetThreadCount(ThreadPool*);
+ThreadPool* ThreadPoolGetDefault(void);
+
+void ThreadPoolGroupInit(ThreadPoolGroup* group);
+int ThreadPoolSubmit(ThreadPool*, ThreadPoolGroup* group, ThreadPoolTaskFunction function, void* argument);
+int ThreadPoolWait(ThreadPool*, ThreadPoolGroup* group);
+
+int ThreadPoolParallelFor(ThreadPool*, size_t begin, size_t end, size_t grain,
+                          ThreadPoolRangeFunction function, void* context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,320 @@
+/**
+ * @file typed_list.h
+ * @author Manuel Haulez
+ * @brief Type-specialized doubly linked lists generated by macro
+ * @version 0.1 2026-10-19 Initial version
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * LIST_DEFINE(IntList, int) emits an IntList type and IntList_Construct,
+ * IntList_AddTail(IntList*, int), IntList_GetHeadData(IntList*) etc. with the
+ * same semantics and return codes as the functions in linked_list.h. Elements
+ * are stored by value inside their node, so copies and compares are of a
+ * compile-time known size and inline to plain moves.
+ *
+ * Elements are compared bytewise like ListRemove does. Types with padding or
+ * with a custom notion of equality can use
+ * LIST_DEFINE_WITH_EQUALS(name, T, equals), where equals(a, b) takes two
+ * pointers to T and is nonzero when they match.
+ */
+
+#ifndef TYPED_LIST_H
+#define TYPED_LIST_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LIST_BYTEWISE_EQUALS(a, b) (memcmp((a), (b), sizeof(*(a))) == 0)
+
+#define LIST_DEFINE(name, T) LIST_DEFINE_WITH_EQUALS(name, T, LIST_BYTEWISE_EQUALS)
+
+#define LIST_DEFINE_WITH_EQUALS(name, T, equals)                                    \
+                                                                                    \
+typedef struct name##_node name##_Node;                                             \
+struct name##_node                                                                  \
+{                                                                                   \
+    name##_Node* prev;                                                              \
+    name##_Node* next;                                                              \
+    T data;                                                                         \
+};                                                                                  \
+                                                                                    \
+typedef struct name##_list name;                                                    \
+struct name##_list                                                                  \
+{                                                                                   \
+    name##_Node* head;                                                              \
+    name##_Node* lastAccessed;                                                      \
+};                                                                                  \
+                                                                                    \
+static inline name* name##_Construct(void)                                          \
+{                                                                                   \
+    name* newList = malloc(sizeof(name));                                           \
+                                                                                    \
+    if (newList == NULL)                                                            \
+    {                                                                               \
+        return NULL;                                                                \
+    }                                                                               \
+                                                                                    \
+    newList->head = NULL;                                                           \
+    newList->lastAccessed = NULL;                                                   \
+                                                                                    \
+    return newList;                                                                 \
+}                                                                                   \
+                                                                                    \
+static inline name##_Node* name##_FindNode(name* this, const T* refData)            \
+{                                                                                   \
+    name##_Node* currentNode = this->head;                                          \
+                                                                                    \
+    while (currentNode != NULL && !equals(&currentNode->data, refData))             \
+    {                                                                               \
+        currentNode = currentNode->next;                                            \
+    }                                                                               \
+                                                                                    \
+    return currentNode;                                                             \
+}                                                                                   \
+                                                                                    \
+static inline name##_Node* name##_TailNode(name* this)                              \
+{                                                                                   \
+    name##_Node* currentNode = this->head;                                          \
+                                                                                    \
+    while (currentNode != NULL && currentNode->next != NULL)                        \
+    {                                                                               \
+        currentNode = currentNode->next;                                            \
+    }                                                                               \
+                                                                                    \
+    return currentNode;                                                             \
+}                                                                                   \
+                                                                                    \
+static inline void name##_Unlink(name* this, name##_Node* node)                    \
+{                                                                                   \
+    if (node == this->lastAccessed)                                                 \
+    {                                                                               \
+        this->lastAccessed = NULL;                                                  \
+    }                                                                               \
+                                                                                    \
+    if (node->prev == NULL)                                                         \
+    {                                                                               \
+        this->head = node->next;                                                    \
+    }                                                                               \
+    else                                                                            \
+    {                                                                               \
+        node->prev->next = node->next;                                              \
+    }                                                                               \
+                                                                                    \
+    if (node->next != NULL)                                                         \
+    {                                                                               \
+        node->next->prev = node->prev;                                              \
+    }                                                                               \
+                                                                                    \
+    free(node);                                                                     \
+}                                                                                   \
+                                                                                    \
+static inline int name##_InsertAfter(name* this, T data, name##_Node* previousNode) \
+{                                                                                   \
+    name##_Node* newNode = malloc(sizeof(name##_Node));                             \
+                                                                                    \
+    if (newNode == NULL)                                                            \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    newNode->data = data;                                                           \
+    newNode->prev = previousNode;                                                   \
+    newNode->next = previousNode == NULL ? this->head : previousNode->next;         \
+                                                                                    \
+    if (newNode->next != NULL)                                                      \
+    {                                                                               \
+        newNode->next->prev = newNode;                                              \
+    }                                                                               \
+                                                                                    \
+    if (previousNode == NULL)                                                       \
+    {                                                                               \
+        this->head = newNode;                                                       \
+    }                                                                               \
+    else                                                                            \
+    {                                                                               \
+        previousNode->next = newNode;                                               \
+    }                                                                               \
+                                                                                    \
+    return 0;                                                                       \
+}                                                                                   \
+                                                                                    \
+static inline int name##_Clear(name* this)                                          \
+{                                                                                   \
+    if (this == NULL)                                                               \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    while (this->head != NULL)                                                      \
+    {                                                                               \
+        name##_Node* temp = this->head->next;                                       \
+        free(this->head);                                                           \
+        this->head = temp;                                                          \
+    }                                                                               \
+                                                                                    \
+    this->lastAccessed = NULL;                                                      \
+                                                                                    \
+    return 0;                                                                       \
+}                                                                                   \
+                                                                                    \
+static inline int name##_Destruct(name** thisPtr)                                   \
+{                                                                                   \
+    if (thisPtr == NULL || *thisPtr == NULL)                                        \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Clear(*thisPtr);                                                         \
+    free(*thisPtr);                                                                 \
+    *thisPtr = NULL;                                                                \
+                                                                                    \
+    return 0;                                                                       \
+}                                                                                   \
+                                                                                    \
+static inline T* name##_GetHeadData(name* this)                                     \
+{                                                                                   \
+    if (this == NULL || this->head == NULL)                                         \
+    {                                                                               \
+        return NULL;                                                                \
+    }                                                                               \
+                                                                                    \
+    this->lastAccessed = this->head;                                                \
+                                                                                    \
+    return &this->head->data;                                                       \
+}                                                                                   \
+                                                                                    \
+static inline T* name##_GetTailData(name* this)                                     \
+{                                                                                   \
+    if (this == NULL || this->head == NULL)                                         \
+    {                                                                               \
+        return NULL;                                                                \
+    }                                                                               \
+                                                                                    \
+    this->lastAccessed = name##_TailNode(this);                                     \
+                                                                                    \
+    return &this->lastAccessed->data;                                               \
+}                                                                                   \
+                                                                                    \
+static inline T* name##_GetNextData(name* this)                                     \
+{                                                                                   \
+    if (this == NULL || this->lastAccessed == NULL)                                 \
+    {                                                                               \
+        return NULL;                                                                \
+    }                                                                               \
+                                                                                    \
+    this->lastAccessed = this->lastAccessed->next;                                  \
+                                                                                    \
+    return this->lastAccessed == NULL ? NULL : &this->lastAccessed->data;           \
+}                                                                                   \
+                                                                                    \
+static inline T* name##_GetPreviousData(name* this)                                 \
+{                                                                                   \
+    if (this == NULL || this->lastAccessed == NULL)                                 \
+    {                                                                               \
+        return NULL;                                                                \
+    }                                                                               \
+                                                                                    \
+    this->lastAccessed = this->lastAccessed->prev;                                  \
+                                                                                    \
+    return this->lastAccessed == NULL ? NULL : &this->lastAccessed->data;           \
+}                                                                                   \
+                                                                                    \
+static inline int name##_AddHead(name* this, T data)                                \
+{                                                                                   \
+    if (this == NULL)                                                               \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    return name##_InsertAfter(this, data, NULL);                                    \
+}                                                                                   \
+                                                                                    \
+static inline int name##_AddTail(name* this, T data)                                \
+{                                                                                   \
+    if (this == NULL)                                                               \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    return name##_InsertAfter(this, data, name##_TailNode(this));                   \
+}                                                                                   \
+                                                                                    \
+static inline int name##_AddBefore(name* this, T data, T refData)                   \
+{                                                                                   \
+    if (this == NULL)                                                               \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Node* refNode = name##_FindNode(this, &refData);                         \
+                                                                                    \
+    if (refNode == NULL)                                                            \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    return name##_InsertAfter(this, data, refNode->prev);                           \
+}                                                                                   \
+                                                                                    \
+static inline int name##_AddAfter(name* this, T data, T refData)                    \
+{                                                                                   \
+    if (this == NULL)                                                               \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Node* refNode = name##_FindNode(this, &refData);                         \
+                                                                                    \
+    if (refNode == NULL)                                                            \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    return name##_InsertAfter(this, data, refNode);                                 \
+}                                                                                   \
+                                                                                    \
+static inline int name##_RemoveHead(name* this)                                     \
+{                                                                                   \
+    if (this == NULL || this->head == NULL)                                         \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Unlink(this, this->head);                                                \
+                                                                                    \
+    return 0;                                                                       \
+}                                                                                   \
+                                                                                    \
+static inline int name##_RemoveTail(name* this)                                     \
+{                                                                                   \
+    if (this == NULL || this->head == NULL)                                         \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Unlink(this, name##_TailNode(this));                                     \
+                                                                                    \
+    return 0;                                                                       \
+}                                                                                   \
+                                                                                    \
+static inline int name##_Remove(name* this, T refData)                              \
+{                                                                                   \
+    if (this == NULL)                                                               \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Node* refNode = name##_FindNode(this, &refData);                         \
+                                                                                    \
+    if (refNode == NULL)                                                            \
+    {                                                                               \
+        return -1;                                                                  \
+    }                                                                               \
+                                                                                    \
+    name##_Unlink(this, refNode);                                                   \
+                                                                                    \
+    return 0;                                                                       \
+}
+
+#endif
@@ -0,0 +1,200 @@
+#include "unity.h"
+#include "compressed_list.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static CompressedList* myList = NULL;
+
+void setUp(void)
+{
+    myList = CompressedListConstruct();
+}
+
+void tearDown(void)
+{
+    CompressedListDestruct(&myList);
+}
+
+static void AssertSequence(const int64_t* expected, size_t count)
+{
+    int64_t value;
+
+    TEST_ASSERT_EQUAL_UINT(count, CompressedListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(0, CompressedListGetFirst(myList, &value));
+
+    for (size_t index = 0; index < count; index++)
+    {
+        TEST_ASSERT_TRUE(expected[index] == value);
+        TEST_ASSERT_EQUAL_INT(index + 1 < count ? 0 : -1, CompressedListGetNext(myList, &value));
+    }
+}
+
+// CompressedListConstruct
+void testCompressedListConstruct(void)
+{
+    CompressedList* newList = CompressedListConstruct();
+    TEST_ASSERT_NOT_NULL(newList);
+    TEST_ASSERT_EQUAL_UINT(0, CompressedListGetLength(newList));
+    TEST_ASSERT_EQUAL_UINT(0, CompressedListGetMemoryUsage(newList));
+
+    TEST_ASSERT_EQUAL_INT(0, CompressedListDestruct(&newList));
+    TEST_ASSERT_NULL(newList);
+}
+
+//CompressedListDestruct
+void testCompressedListDestruct_WhenListIsNULL_Return(void)
+{
+    CompressedList* newList = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListDestruct(&newList));
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListDestruct(NULL));
+}
+
+//CompressedListAppend
+void testCompressedListAppend(void)
+{
+    int64_t values[] = {5, 6, 7, 1000, 3, -42, INT64_MAX, INT64_MIN, 0};
+
+    for (size_t index = 0; index < sizeof(values) / sizeof(values[0]); index++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, CompressedListAppend(myList, values[index]));
+    }
+
+    AssertSequence(values, sizeof(values) / sizeof(values[0]));
+}
+
+void testCompressedListAppend_WhenIdsAreDense_UseLessThanTwoBytesPerValue(void)
+{
+    static int64_t values[100000];
+
+    for (size_t index = 0; index < 100000; index++)
+    {
+        values[index] = 1000000 + (int64_t)index * 3 + (int64_t)(index % 7 == 0);
+        CompressedListAppend(myList, values[index]);
+    }
+
+    AssertSequence(values, 100000);
+    TEST_ASSERT_TRUE(CompressedListGetMemoryUsage(myList) < 2 * 100000);
+}
+
+void testCompressedListAppend_WhenDeltasAreLarge_SpanBlocks(void)
+{
+    static int64_t values[5000];
+
+    for (size_t index = 0; index < 5000; index++)
+    {
+        values[index] = (int64_t)(index * index * 977) * (index % 2 == 0 ? 1 : -1);
+        CompressedListAppend(myList, values[index]);
+    }
+
+    AssertSequence(values, 5000);
+}
+
+void testCompressedListAppend_WhenListIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListAppend(NULL, 1));
+}
+
+//CompressedListContains
+void testCompressedListContains(void)
+{
+    for (int64_t value = 0; value < 3000; value += 2)
+    {
+        CompressedListAppend(myList, value);
+    }
+
+    TEST_ASSERT_EQUAL_INT(1, CompressedListContains(myList, 0));
+    TEST_ASSERT_EQUAL_INT(1, CompressedListContains(myList, 1500));
+    TEST_ASSERT_EQUAL_INT(1, CompressedListContains(myList, 2998));
+    TEST_ASSERT_EQUAL_INT(0, CompressedListContains(myList, 1501));
+    TEST_ASSERT_EQUAL_INT(0, CompressedListContains(myList, -2));
+    TEST_ASSERT_EQUAL_INT(0, CompressedListContains(myList, 3000));
+}
+
+void testCompressedListContains_WhenValuesAreUnsorted_SearchEveryBlock(void)
+{
+    for (int64_t value = 0; value < 2000; value++)
+    {
+        CompressedListAppend(myList, value % 2 == 0 ? value : -value);
+    }
+
+    TEST_ASSERT_EQUAL_INT(1, CompressedListContains(myList, -1999));
+    TEST_ASSERT_EQUAL_INT(1, CompressedListContains(myList, 1998));
+    TEST_ASSERT_EQUAL_INT(0, CompressedListContains(myList, 1999));
+}
+
+void testCompressedListContains_WhenListIsNULL_ReturnZero(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, CompressedListContains(NULL, 1));
+}
+
+//CompressedListClear
+void testCompressedListClear(void)
+{
+    int64_t value;
+
+    CompressedListAppend(myList, 20);
+    CompressedListAppend(myList, 10);
+
+    TEST_ASSERT_EQUAL_INT(0, CompressedListClear(myList));
+    TEST_ASSERT_EQUAL_UINT(0, CompressedListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListGetFirst(myList, &value));
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListGetNext(myList, &value));
+
+    CompressedListAppend(myList, 30);
+    TEST_ASSERT_EQUAL_INT(1, CompressedListContains(myList, 30));
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListClear(NULL));
+}
+
+//CompressedListGetNext
+void testCompressedListGetNext_WhenValueIsAppendedAtCursor_ReturnIt(void)
+{
+    int64_t value;
+
+    CompressedListAppend(myList, 1);
+    CompressedListGetFirst(myList, &value);
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListGetNext(myList, &value));
+
+    CompressedListAppend(myList, 2);
+    TEST_ASSERT_EQUAL_INT(0, CompressedListGetNext(myList, &value));
+    TEST_ASSERT_TRUE(value == 2);
+}
+
+void testCompressedListGetNext_WhenArgumentIsNULL_Return(void)
+{
+    int64_t value;
+
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListGetNext(myList, &value));
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListGetNext(NULL, &value));
+    TEST_ASSERT_EQUAL_INT(-1, CompressedListGetFirst(myList, NULL));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // CompressedListConstruct
+    MY_RUN_TEST(testCompressedListConstruct);
+
+    //CompressedListDestruct
+    MY_RUN_TEST(testCompressedListDestruct_WhenListIsNULL_Return);
+
+    //CompressedListAppend
+    MY_RUN_TEST(testCompressedListAppend);
+    MY_RUN_TEST(testCompressedListAppend_WhenIdsAreDense_UseLessThanTwoBytesPerValue);
+    MY_RUN_TEST(testCompressedListAppend_WhenDeltasAreLarge_SpanBlocks);
+    MY_RUN_TEST(testCompressedListAppend_WhenListIsNULL_Return);
+
+    //CompressedListContains
+    MY_RUN_TEST(testCompressedListContains);
+    MY_RUN_TEST(testCompressedListContains_WhenValuesAreUnsorted_SearchEveryBlock);
+    MY_RUN_TEST(testCompressedListContains_WhenListIsNULL_ReturnZero);
+
+    //CompressedListClear
+    MY_RUN_TEST(testCompressedListClear);
+
+    //CompressedListGetNext
+    MY_RUN_TEST(testCompressedListGetNext_WhenValueIsAppendedAtCursor_ReturnIt);
+    MY_RUN_TEST(testCompressedListGetNext_WhenArgumentIsNULL_Return);
+
+    return UnityEnd();
+}
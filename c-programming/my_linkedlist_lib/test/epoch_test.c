@@ -0,0 +1,277 @@
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "epoch.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static EpochDomain* myDomain = NULL;
+
+void setUp(void)
+{
+    myDomain = EpochDomainConstruct();
+}
+
+void tearDown(void)
+{
+    EpochDomainDestruct(&myDomain);
+}
+
+static void CountFree(void* object, void* context)
+{
+    (void)object;
+    __atomic_add_fetch((int*)context, 1, __ATOMIC_RELAXED);
+}
+
+// EpochDomainConstruct
+void testEpochDomainConstruct(void)
+{
+    EpochDomain* newDomain = EpochDomainConstruct();
+    TEST_ASSERT_NOT_NULL(newDomain);
+    TEST_ASSERT_EQUAL_UINT(0, EpochGetPendingCount(newDomain));
+
+    TEST_ASSERT_EQUAL_INT(0, EpochDomainDestruct(&newDomain));
+    TEST_ASSERT_NULL(newDomain);
+}
+
+//EpochDomainDestruct
+void testEpochDomainDestruct_WhenDomainIsNULL_Return(void)
+{
+    EpochDomain* newDomain = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, EpochDomainDestruct(&newDomain));
+    TEST_ASSERT_EQUAL_INT(-1, EpochDomainDestruct(NULL));
+}
+
+void testEpochDomainDestruct_WhenReaderIsRegistered_Return(void)
+{
+    EpochReader* reader = EpochReaderRegister(myDomain);
+
+    TEST_ASSERT_EQUAL_INT(-1, EpochDomainDestruct(&myDomain));
+    TEST_ASSERT_NOT_NULL(myDomain);
+
+    EpochReaderUnregister(&reader);
+}
+
+void testEpochDomainDestruct_FreesPendingObjects(void)
+{
+    int freedCount = 0;
+    EpochReader* reader = EpochReaderRegister(myDomain);
+
+    EpochEnter(reader);
+    EpochRetire(myDomain, NULL, CountFree, &freedCount);
+    EpochExit(reader);
+    EpochReaderUnregister(&reader);
+
+    TEST_ASSERT_EQUAL_INT(0, EpochDomainDestruct(&myDomain));
+    TEST_ASSERT_EQUAL_INT(1, freedCount);
+}
+
+//EpochDomainGetDefault
+void testEpochDomainGetDefault(void)
+{
+    EpochDomain* domain = EpochDomainGetDefault();
+    TEST_ASSERT_NOT_NULL(domain);
+    TEST_ASSERT_TRUE(domain == EpochDomainGetDefault());
+}
+
+//EpochReaderRegister
+void testEpochReaderRegister_WhenDomainIsNULL_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(EpochReaderRegister(NULL));
+}
+
+void testEpochReaderUnregister_WhenReaderIsNULL_Return(void)
+{
+    EpochReader* reader = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, EpochReaderUnregister(&reader));
+    TEST_ASSERT_EQUAL_INT(-1, EpochReaderUnregister(NULL));
+}
+
+//EpochRetire
+void testEpochRetire(void)
+{
+    int freedCount = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, EpochRetire(myDomain, NULL, CountFree, &freedCount));
+    TEST_ASSERT_EQUAL_UINT(1, EpochGetPendingCount(myDomain));
+    TEST_ASSERT_EQUAL_INT(0, freedCount);
+
+    TEST_ASSERT_EQUAL_INT(0, EpochSynchronize(myDomain));
+    TEST_ASSERT_EQUAL_UINT(0, EpochGetPendingCount(myDomain));
+    TEST_ASSERT_EQUAL_INT(1, freedCount);
+}
+
+void testEpochRetire_WhenArgumentIsNULL_Return(void)
+{
+    int freedCount = 0;
+    TEST_ASSERT_EQUAL_INT(-1, EpochRetire(NULL, NULL, CountFree, &freedCount));
+    TEST_ASSERT_EQUAL_INT(-1, EpochRetire(myDomain, NULL, NULL, NULL));
+}
+
+void testEpochRetire_WhenManyArePending_FreeWithoutReclaim(void)
+{
+    int freedCount = 0;
+
+    for (int index = 0; index < 1000; index++)
+    {
+        EpochRetire(myDomain, NULL, CountFree, &freedCount);
+    }
+
+    TEST_ASSERT_TRUE(freedCount > 0);
+    TEST_ASSERT_EQUAL_UINT(1000 - freedCount, EpochGetPendingCount(myDomain));
+
+    EpochSynchronize(myDomain);
+    TEST_ASSERT_EQUAL_INT(1000, freedCount);
+}
+
+//EpochReclaim
+void testEpochReclaim_WhenReaderIsInside_KeepObject(void)
+{
+    int freedCount = 0;
+    EpochReader* reader = EpochReaderRegister(myDomain);
+
+    EpochEnter(reader);
+    EpochRetire(myDomain, NULL, CountFree, &freedCount);
+
+    EpochReclaim(myDomain);
+    EpochReclaim(myDomain);
+    TEST_ASSERT_EQUAL_INT(0, freedCount);
+
+    EpochExit(reader);
+    TEST_ASSERT_EQUAL_UINT(1, EpochReclaim(myDomain));
+    TEST_ASSERT_EQUAL_INT(1, freedCount);
+
+    EpochReaderUnregister(&reader);
+}
+
+void testEpochReclaim_WhenReaderEnteredAfterRetire_FreeObject(void)
+{
+    int freedCount = 0;
+    EpochReader* reader = EpochReaderRegister(myDomain);
+
+    EpochRetire(myDomain, NULL, CountFree, &freedCount);
+    EpochEnter(reader);
+
+    EpochReclaim(myDomain);
+    EpochExit(reader);
+    EpochReclaim(myDomain);
+
+    TEST_ASSERT_EQUAL_INT(1, freedCount);
+    EpochReaderUnregister(&reader);
+}
+
+void testEpochReclaim_WhenDomainIsNULL_ReturnZero(void)
+{
+    TEST_ASSERT_EQUAL_UINT(0, EpochReclaim(NULL));
+}
+
+//EpochSynchronize
+typedef struct delayed_reader DelayedReader;
+struct delayed_reader
+{
+    EpochReader* reader;
+    int entered;
+    int release;
+    int* freedCount;
+    int freedWhileInside;
+};
+
+static void* ReadUntilReleased(void* argument)
+{
+    DelayedReader* delayed = argument;
+
+    EpochEnter(delayed->reader);
+    __atomic_store_n(&delayed->entered, 1, __ATOMIC_RELEASE);
+
+    while (!__atomic_load_n(&delayed->release, __ATOMIC_ACQUIRE))
+    {
+        sched_yield();
+    }
+
+    delayed->freedWhileInside = __atomic_load_n(delayed->freedCount, __ATOMIC_RELAXED);
+    EpochExit(delayed->reader);
+
+    return NULL;
+}
+
+static void* ReleaseLater(void* argument)
+{
+    DelayedReader* delayed = argument;
+
+    for (int round = 0; round < 1000; round++)
+    {
+        sched_yield();
+    }
+
+    __atomic_store_n(&delayed->release, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+void testEpochSynchronize_WaitsForActiveReader(void)
+{
+    int freedCount = 0;
+    DelayedReader delayed = {EpochReaderRegister(myDomain), 0, 0, &freedCount, -1};
+    pthread_t readerThread;
+    pthread_t releaseThread;
+
+    pthread_create(&readerThread, NULL, ReadUntilReleased, &delayed);
+
+    while (!__atomic_load_n(&delayed.entered, __ATOMIC_ACQUIRE))
+    {
+        sched_yield();
+    }
+
+    EpochRetire(myDomain, NULL, CountFree, &freedCount);
+    pthread_create(&releaseThread, NULL, ReleaseLater, &delayed);
+
+    TEST_ASSERT_EQUAL_INT(0, EpochSynchronize(myDomain));
+    TEST_ASSERT_EQUAL_INT(1, freedCount);
+
+    pthread_join(readerThread, NULL);
+    pthread_join(releaseThread, NULL);
+    TEST_ASSERT_EQUAL_INT(0, delayed.freedWhileInside);
+
+    EpochReaderUnregister(&delayed.reader);
+}
+
+void testEpochSynchronize_WhenDomainIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, EpochSynchronize(NULL));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // EpochDomainConstruct
+    MY_RUN_TEST(testEpochDomainConstruct);
+
+    //EpochDomainDestruct
+    MY_RUN_TEST(testEpochDomainDestruct_WhenDomainIsNULL_Return);
+    MY_RUN_TEST(testEpochDomainDestruct_WhenReaderIsRegistered_Return);
+    MY_RUN_TEST(testEpochDomainDestruct_FreesPendingObjects);
+
+    //EpochDomainGetDefault
+    MY_RUN_TEST(testEpochDomainGetDefault);
+
+    //EpochReaderRegister
+    MY_RUN_TEST(testEpochReaderRegister_WhenDomainIsNULL_ReturnNULL);
+    MY_RUN_TEST(testEpochReaderUnregister_WhenReaderIsNULL_Return);
+
+    //EpochRetire
+    MY_RUN_TEST(testEpochRetire);
+    MY_RUN_TEST(testEpochRetire_WhenArgumentIsNULL_Return);
+    MY_RUN_TEST(testEpochRetire_WhenManyArePending_FreeWithoutReclaim);
+
+    //EpochReclaim
+    MY_RUN_TEST(testEpochReclaim_WhenReaderIsInside_KeepObject);
+    MY_RUN_TEST(testEpochReclaim_WhenReaderEnteredAfterRetire_FreeObject);
+    MY_RUN_TEST(testEpochReclaim_WhenDomainIsNULL_ReturnZero);
+
+    //EpochSynchronize
+    MY_RUN_TEST(testEpochSynchronize_WaitsForActiveReader);
+    MY_RUN_TEST(testEpochSynchronize_WhenDomainIsNULL_Return);
+
+    return UnityEnd();
+}
@@ -0,0 +1,268 @@
+#include <stdint.h>
+#include <string.h>
+#include "unity.h"
+#include "hash_map.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static HashMap* myMap = NULL;
+
+typedef struct wide_key WideKey;
+struct wide_key
+{
+    char name[21];
+};
+
+void setUp(void)
+{
+    myMap = HashMapConstruct(sizeof(int), sizeof(int));
+}
+
+void tearDown(void)
+{
+    HashMapDestruct(&myMap);
+}
+
+// HashMapConstruct
+void testHashMapConstruct(void)
+{
+    HashMap* newMap = HashMapConstruct(sizeof(int), sizeof(double));
+    TEST_ASSERT_NOT_NULL(newMap);
+    TEST_ASSERT_EQUAL_UINT(0, HashMapGetSize(newMap));
+
+    TEST_ASSERT_EQUAL_INT(0, HashMapDestruct(&newMap));
+    TEST_ASSERT_NULL(newMap);
+}
+
+void testHashMapConstruct_WhenSizesAreInvalid_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(HashMapConstruct(0, sizeof(int)));
+    TEST_ASSERT_NULL(HashMapConstruct(sizeof(int), -1));
+}
+
+//HashMapDestruct
+void testHashMapDestruct_WhenMapIsNULL_Return(void)
+{
+    HashMap* newMap = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, HashMapDestruct(&newMap));
+    TEST_ASSERT_EQUAL_INT(-1, HashMapDestruct(NULL));
+}
+
+//HashMapPut
+void testHashMapPut(void)
+{
+    int key = 42;
+    int value = 4200;
+
+    TEST_ASSERT_EQUAL_INT(0, HashMapPut(myMap, &key, &value));
+    TEST_ASSERT_EQUAL_UINT(1, HashMapGetSize(myMap));
+    TEST_ASSERT_EQUAL_INT(4200, *(int*)HashMapGet(myMap, &key));
+}
+
+void testHashMapPut_WhenKeyExists_ReplaceValue(void)
+{
+    int key = 42;
+    int value = 4200;
+
+    HashMapPut(myMap, &key, &value);
+    value = 4201;
+    HashMapPut(myMap, &key, &value);
+
+    TEST_ASSERT_EQUAL_UINT(1, HashMapGetSize(myMap));
+    TEST_ASSERT_EQUAL_INT(4201, *(int*)HashMapGet(myMap, &key));
+}
+
+void testHashMapPut_WhenArgumentIsNULL_Return(void)
+{
+    int key = 42;
+    int value = 4200;
+    TEST_ASSERT_EQUAL_INT(-1, HashMapPut(NULL, &key, &value));
+    TEST_ASSERT_EQUAL_INT(-1, HashMapPut(myMap, NULL, &value));
+    TEST_ASSERT_EQUAL_INT(-1, HashMapPut(myMap, &key, NULL));
+}
+
+void testHashMapPut_GrowsBeyondInitialCapacity(void)
+{
+    for (int key = 0; key < 10000; key++)
+    {
+        int value = -key;
+        TEST_ASSERT_EQUAL_INT(0, HashMapPut(myMap, &key, &value));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(10000, HashMapGetSize(myMap));
+
+    for (int key = 0; key < 10000; key++)
+    {
+        int* value = HashMapGet(myMap, &key);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_INT(-key, *value);
+    }
+}
+
+void testHashMapPut_WithOddSizedKeys(void)
+{
+    HashMap* names = HashMapConstruct(sizeof(WideKey), sizeof(double));
+    WideKey key;
+    double value = 2.5;
+
+    memcpy(key.name, "abcdefghijklmnopqrstu", sizeof(key.name));
+
+    HashMapPut(names, &key, &value);
+    TEST_ASSERT_TRUE(*(double*)HashMapGet(names, &key) == 2.5);
+    TEST_ASSERT_EQUAL_UINT(0, (uintptr_t)HashMapGet(names, &key) % sizeof(double));
+
+    key.name[0] = 'T';
+    TEST_ASSERT_NULL(HashMapGet(names, &key));
+
+    HashMapDestruct(&names);
+}
+
+void testHashMapPut_WhenValueSizeIsZero_ActsAsSet(void)
+{
+    HashMap* set = HashMapConstruct(sizeof(int), 0);
+    int key = 5;
+
+    TEST_ASSERT_EQUAL_INT(0, HashMapPut(set, &key, NULL));
+    TEST_ASSERT_NOT_NULL(HashMapGet(set, &key));
+
+    HashMapDestruct(&set);
+}
+
+//HashMapGet
+void testHashMapGet_WhenKeyIsMissing_ReturnNULL(void)
+{
+    int key = 42;
+    int missing = 43;
+    int value = 4200;
+
+    HashMapPut(myMap, &key, &value);
+    TEST_ASSERT_NULL(HashMapGet(myMap, &missing));
+    TEST_ASSERT_NULL(HashMapGet(NULL, &key));
+    TEST_ASSERT_NULL(HashMapGet(myMap, NULL));
+}
+
+//HashMapRemove
+void testHashMapRemove(void)
+{
+    int key = 42;
+    int value = 4200;
+
+    HashMapPut(myMap, &key, &value);
+    TEST_ASSERT_EQUAL_INT(0, HashMapRemove(myMap, &key));
+    TEST_ASSERT_EQUAL_UINT(0, HashMapGetSize(myMap));
+    TEST_ASSERT_NULL(HashMapGet(myMap, &key));
+}
+
+void testHashMapRemove_WhenKeyIsMissing_Return(void)
+{
+    int key = 42;
+    TEST_ASSERT_EQUAL_INT(-1, HashMapRemove(myMap, &key));
+    TEST_ASSERT_EQUAL_INT(-1, HashMapRemove(NULL, &key));
+}
+
+void testHashMapRemove_KeepsProbeRunsIntact(void)
+{
+    static unsigned char present[4096];
+    uint32_t state = 12345;
+
+    memset(present, 0, sizeof(present));
+
+    for (int step = 0; step < 200000; step++)
+    {
+        state = state * 1664525u + 1013904223u;
+        int key = (int)((state >> 8) % sizeof(present));
+
+        if (state & 0x80)
+        {
+            HashMapPut(myMap, &key, &key);
+            present[key] = 1;
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_INT(present[key] ? 0 : -1, HashMapRemove(myMap, &key));
+            present[key] = 0;
+        }
+    }
+
+    size_t expectedSize = 0;
+
+    for (int key = 0; key < (int)sizeof(present); key++)
+    {
+        int* value = HashMapGet(myMap, &key);
+        expectedSize += present[key];
+
+        if (present[key])
+        {
+            TEST_ASSERT_NOT_NULL(value);
+            TEST_ASSERT_EQUAL_INT(key, *value);
+        }
+        else
+        {
+            TEST_ASSERT_NULL(value);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT(expectedSize, HashMapGetSize(myMap));
+}
+
+//HashMapClear
+void testHashMapClear(void)
+{
+    int key = 42;
+    int value = 4200;
+
+    HashMapPut(myMap, &key, &value);
+    TEST_ASSERT_EQUAL_INT(0, HashMapClear(myMap));
+    TEST_ASSERT_EQUAL_UINT(0, HashMapGetSize(myMap));
+    TEST_ASSERT_NULL(HashMapGet(myMap, &key));
+    TEST_ASSERT_EQUAL_INT(-1, HashMapClear(NULL));
+}
+
+//HashMapReserve
+void testHashMapReserve(void)
+{
+    int key = 42;
+    int value = 4200;
+
+    HashMapPut(myMap, &key, &value);
+    TEST_ASSERT_EQUAL_INT(0, HashMapReserve(myMap, 100000));
+    TEST_ASSERT_EQUAL_INT(4200, *(int*)HashMapGet(myMap, &key));
+    TEST_ASSERT_EQUAL_INT(0, HashMapReserve(myMap, 10));
+    TEST_ASSERT_EQUAL_INT(-1, HashMapReserve(NULL, 10));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // HashMapConstruct
+    MY_RUN_TEST(testHashMapConstruct);
+    MY_RUN_TEST(testHashMapConstruct_WhenSizesAreInvalid_ReturnNULL);
+
+    //HashMapDestruct
+    MY_RUN_TEST(testHashMapDestruct_WhenMapIsNULL_Return);
+
+    //HashMapPut
+    MY_RUN_TEST(testHashMapPut);
+    MY_RUN_TEST(testHashMapPut_WhenKeyExists_ReplaceValue);
+    MY_RUN_TEST(testHashMapPut_WhenArgumentIsNULL_Return);
+    MY_RUN_TEST(testHashMapPut_GrowsBeyondInitialCapacity);
+    MY_RUN_TEST(testHashMapPut_WithOddSizedKeys);
+    MY_RUN_TEST(testHashMapPut_WhenValueSizeIsZero_ActsAsSet);
+
+    //HashMapGet
+    MY_RUN_TEST(testHashMapGet_WhenKeyIsMissing_ReturnNULL);
+
+    //HashMapRemove
+    MY_RUN_TEST(testHashMapRemove);
+    MY_RUN_TEST(testHashMapRemove_WhenKeyIsMissing_Return);
+    MY_RUN_TEST(testHashMapRemove_KeepsProbeRunsIntact);
+
+    //HashMapClear
+    MY_RUN_TEST(testHashMapClear);
+
+    //HashMapReserve
+    MY_RUN_TEST(testHashMapReserve);
+
+    return UnityEnd();
+}
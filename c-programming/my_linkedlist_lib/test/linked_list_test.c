@@ -1,7 +1,11 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
 #include "unity.h"
 #include "linked_list.h"
 
 #define MY_RUN_TEST(func) RUN_TEST(func, 0)
+#define MY_RUN_SERIAL_TEST(func) RUN_TEST_SERIAL(func, 0)
 
 static List* myList = NULL;
 
@@ -425,6 +429,44 @@ void testListAddTail_WhenListIsEmpty_AddNodeToEndOfList(void)
     TEST_ASSERT_NULL(elementPtr);
 }
 
+void testListAddTail_WhenInlineSlotsAreExhausted_KeepOrder(void)
+{
+    for (int index = 0; index < 20; index++)
+    {
+        Element element = {index};
+        TEST_ASSERT_EQUAL_INT(0, ListAddTail(myList, &element));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(20, ListGetLength(myList));
+
+    int expected = 0;
+
+    for (Element* elementPtr = ListGetHeadData(myList); elementPtr != NULL; elementPtr = ListGetNextData(myList))
+    {
+        TEST_ASSERT_EQUAL_INT(expected++, elementPtr->address);
+    }
+
+    TEST_ASSERT_EQUAL_INT(20, expected);
+}
+
+void testListAddTail_WhenElementsAreLarge_StoreFullElement(void)
+{
+    unsigned char block[4096];
+    List* newList = ListConstruct(sizeof(block));
+
+    for (int index = 0; index < 3; index++)
+    {
+        memset(block, index + 1, sizeof(block));
+        TEST_ASSERT_EQUAL_INT(0, ListAddTail(newList, block));
+    }
+
+    unsigned char* blockPtr = ListGetTailData(newList);
+    TEST_ASSERT_EQUAL_UINT8(3, blockPtr[0]);
+    TEST_ASSERT_EQUAL_UINT8(3, blockPtr[sizeof(block) - 1]);
+
+    ListDestruct(&newList);
+}
+
 //ListAddBefore
 void testListAddBefore(void)
 {
@@ -646,6 +688,217 @@ void testListAddAfter_WhenRefDataExist_AddNewNodeBetweenNodes(void)
     TEST_ASSERT_EQUAL_INT(60, elementPtr->address);
 }
 
+//ListAdoptHead
+static Element* NewElement(int address)
+{
+    Element* element = malloc(sizeof(Element));
+    element->address = address;
+    return element;
+}
+
+void testListAdoptHead(void)
+{
+    Element* a = NewElement(20);
+    Element* b = NewElement(240);
+
+    TEST_ASSERT_EQUAL_INT(0, ListAdoptHead(myList, a));
+    TEST_ASSERT_EQUAL_INT(0, ListAdoptHead(myList, b));
+
+    TEST_ASSERT_TRUE(ListGetHeadData(myList) == b);
+    TEST_ASSERT_TRUE(ListGetNextData(myList) == a);
+    TEST_ASSERT_EQUAL_UINT(2, ListGetLength(myList));
+}
+
+void testListAdoptHead_WhenArgumentIsNULL_Return(void)
+{
+    Element* a = NewElement(20);
+
+    TEST_ASSERT_EQUAL_INT(-1, ListAdoptHead(NULL, a));
+    TEST_ASSERT_EQUAL_INT(-1, ListAdoptHead(myList, NULL));
+    free(a);
+}
+
+//ListAdoptTail
+void testListAdoptTail(void)
+{
+    Element a = {20};
+    Element* b = NewElement(240);
+
+    ListAddTail(myList, &a);
+    TEST_ASSERT_EQUAL_INT(0, ListAdoptTail(myList, b));
+
+    Element* elementPtr = ListGetHeadData(myList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    TEST_ASSERT_TRUE(ListGetNextData(myList) == b);
+    TEST_ASSERT_NULL(ListGetNextData(myList));
+}
+
+void testListAdoptTail_WhenElementIsRemoved_FreeBuffer(void)
+{
+    ListAdoptTail(myList, NewElement(20));
+    ListAdoptTail(myList, NewElement(240));
+    ListAdoptTail(myList, NewElement(60));
+
+    Element b = {240};
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &b));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveTail(myList));
+    TEST_ASSERT_EQUAL_INT(0, ListClear(myList));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+}
+
+void testListAdoptTail_WhenListIsRcu_ReadersFindNextElement(void)
+{
+    EpochDomain* domain = EpochDomainConstruct();
+
+    ListEnableRcu(myList, domain);
+    TEST_ASSERT_EQUAL_INT(0, ListAdoptTail(myList, NewElement(20)));
+    TEST_ASSERT_EQUAL_INT(0, ListAdoptTail(myList, NewElement(240)));
+
+    const Element* elementPtr = ListRcuGetHeadData(myList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    elementPtr = ListRcuGetNextData(myList, elementPtr);
+    TEST_ASSERT_EQUAL_INT(240, elementPtr->address);
+
+    ListDestruct(&myList);
+    TEST_ASSERT_EQUAL_INT(0, EpochDomainDestruct(&domain));
+}
+
+//ListAdoptAfter
+void testListAdoptAfter(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element* c = NewElement(60);
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    TEST_ASSERT_EQUAL_INT(0, ListAdoptAfter(myList, c, &a));
+
+    Element* elementPtr = ListGetHeadData(myList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    TEST_ASSERT_TRUE(ListGetNextData(myList) == c);
+
+    elementPtr = ListGetNextData(myList);
+    TEST_ASSERT_EQUAL_INT(240, elementPtr->address);
+}
+
+void testListAdoptAfter_WhenRefDataIsNotFound_Return(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element* c = NewElement(60);
+
+    ListAddTail(myList, &a);
+    TEST_ASSERT_EQUAL_INT(-1, ListAdoptAfter(myList, c, &b));
+    TEST_ASSERT_EQUAL_INT(-1, ListAdoptAfter(myList, c, NULL));
+    free(c);
+}
+
+//ListEmplaceHead
+void testListEmplaceHead(void)
+{
+    Element a = {20};
+
+    ListAddTail(myList, &a);
+    Element* elementPtr = ListEmplaceHead(myList);
+    TEST_ASSERT_NOT_NULL(elementPtr);
+    elementPtr->address = 240;
+
+    elementPtr = ListGetHeadData(myList);
+    TEST_ASSERT_EQUAL_INT(240, elementPtr->address);
+    elementPtr = ListGetNextData(myList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+}
+
+void testListEmplaceHead_WhenListIsNULL_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(ListEmplaceHead(NULL));
+}
+
+void testListEmplaceHead_WhenListIsRcu_ReturnNULL(void)
+{
+    ListEnableRcu(myList, NULL);
+    TEST_ASSERT_NULL(ListEmplaceHead(myList));
+    TEST_ASSERT_NULL(ListEmplaceTail(myList));
+}
+
+//ListEmplaceTail
+void testListEmplaceTail(void)
+{
+    for (int index = 0; index < 20; index++)
+    {
+        Element* elementPtr = ListEmplaceTail(myList);
+        elementPtr->address = index;
+    }
+
+    TEST_ASSERT_EQUAL_UINT(20, ListGetLength(myList));
+
+    int index = 0;
+
+    for (Element* elementPtr = ListGetHeadData(myList); elementPtr != NULL; elementPtr = ListGetNextData(myList))
+    {
+        TEST_ASSERT_EQUAL_INT(index++, elementPtr->address);
+    }
+
+    TEST_ASSERT_EQUAL_INT(20, index);
+}
+
+//ListEmplaceAfterCursor
+void testListEmplaceAfterCursor(void)
+{
+    Element a = {20};
+    Element b = {240};
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListGetHeadData(myList);
+
+    ((Element*)ListEmplaceAfterCursor(myList))->address = 60;
+    ((Element*)ListEmplaceAfterCursor(myList))->address = 80;
+
+    Element* elementPtr = ListGetNextData(myList);
+    TEST_ASSERT_EQUAL_INT(240, elementPtr->address);
+    elementPtr = ListGetPreviousData(myList);
+    TEST_ASSERT_EQUAL_INT(80, elementPtr->address);
+    elementPtr = ListGetPreviousData(myList);
+    TEST_ASSERT_EQUAL_INT(60, elementPtr->address);
+    elementPtr = ListGetPreviousData(myList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+}
+
+void testListEmplaceAfterCursor_WhenNoElementWasAccessed_ReturnNULL(void)
+{
+    Element a = {20};
+
+    ListAddTail(myList, &a);
+    TEST_ASSERT_NULL(ListEmplaceAfterCursor(myList));
+    TEST_ASSERT_NULL(ListEmplaceAfterCursor(NULL));
+    TEST_ASSERT_EQUAL_UINT(1, ListGetLength(myList));
+}
+
+//ListReserve
+void testListReserve(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, ListReserve(myList, 100));
+
+    for (int index = 0; index < 100; index++)
+    {
+        ((Element*)ListEmplaceHead(myList))->address = index;
+    }
+
+    TEST_ASSERT_EQUAL_UINT(100, ListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(0, ListClear(myList));
+
+    Element* elementPtr = ListEmplaceHead(myList);
+    elementPtr->address = 20;
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetHeadData(myList))->address);
+}
+
+void testListReserve_WhenListIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListReserve(NULL, 10));
+}
+
 //ListRemoveHead
 void testListRemoveHead(void)
 {
@@ -672,6 +925,64 @@ void testListRemoveHead_WhenListIsEmpty_Return(void)
     TEST_ASSERT_EQUAL_INT(-1, ListRemoveHead(myList));
 }
 
+//ListDetachHead
+void testListDetachHead_WhenBufferIsAdopted_ReturnSameBuffer(void)
+{
+    Element* a = NewElement(20);
+    Element b = {240};
+
+    ListAdoptTail(myList, a);
+    ListAddTail(myList, &b);
+
+    Element* elementPtr = ListDetachHead(myList);
+    TEST_ASSERT_TRUE(elementPtr == a);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    TEST_ASSERT_EQUAL_UINT(1, ListGetLength(myList));
+    free(elementPtr);
+
+    elementPtr = ListGetHeadData(myList);
+    TEST_ASSERT_EQUAL_INT(240, elementPtr->address);
+}
+
+void testListDetachHead_WhenElementIsCopied_ReturnNewBuffer(void)
+{
+    Element a = {20};
+
+    ListAddTail(myList, &a);
+
+    Element* elementPtr = ListDetachHead(myList);
+    TEST_ASSERT_NOT_NULL(elementPtr);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+    free(elementPtr);
+}
+
+void testListDetachHead_WhenSnapshotIsAlive_CopyData(void)
+{
+    Element* a = NewElement(20);
+
+    ListAdoptTail(myList, a);
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    Element* elementPtr = ListDetachHead(myList);
+    TEST_ASSERT_TRUE(elementPtr != a);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    free(elementPtr);
+
+    const Element* snapshotPtr = ListSnapshotGetHeadData(snapshot);
+    TEST_ASSERT_TRUE(snapshotPtr == a);
+    TEST_ASSERT_EQUAL_INT(20, snapshotPtr->address);
+    TEST_ASSERT_NULL(ListGetHeadData(myList));
+
+    ListSnapshotRelease(&snapshot);
+}
+
+void testListDetachHead_WhenListIsEmpty_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(ListDetachHead(myList));
+    TEST_ASSERT_NULL(ListDetachHead(NULL));
+}
+
 //ListRemoveTail
 void testListRemoveTail(void)
 {
@@ -805,6 +1116,37 @@ void testListRemove_WhenRefDataIsLastNode_RemoveNode(void)
     TEST_ASSERT_NULL(elementPtr);
 }
 
+void testListRemove_WhenInlineSlotsAreReused_KeepOrder(void)
+{
+    for (int index = 0; index < 12; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    for (int index = 0; index < 12; index += 2)
+    {
+        Element element = {index};
+        TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &element));
+    }
+
+    for (int index = 12; index < 18; index++)
+    {
+        Element element = {index};
+        ListAddHead(myList, &element);
+    }
+
+    int expected[] = {17, 16, 15, 14, 13, 12, 1, 3, 5, 7, 9, 11};
+    int position = 0;
+
+    for (Element* elementPtr = ListGetHeadData(myList); elementPtr != NULL; elementPtr = ListGetNextData(myList))
+    {
+        TEST_ASSERT_EQUAL_INT(expected[position++], elementPtr->address);
+    }
+
+    TEST_ASSERT_EQUAL_INT(12, position);
+}
+
 //ListClear
 void testListClear(void)
 {
@@ -835,99 +1177,2058 @@ void testListClear_WhenListIsEmpty()
     TEST_ASSERT_EQUAL_INT(0, ListClear(myList));
 }
 
-int main()
+//ListGetLength
+void testListGetLength(void)
 {
-    UnityBegin();
+    Element a = {20};
+    Element b = {240};
 
-    // ListConstruct
-    MY_RUN_TEST(testListConstruct);
-    MY_RUN_TEST(testListConstruct_WhenDataSizeIsZero_ReturnNULL);
-    MY_RUN_TEST(testListConstruct_WhenDataSizeIsLessThenZero_ReturnNULL);
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+    ListAddTail(myList, &a);
+    ListAddHead(myList, &b);
+    TEST_ASSERT_EQUAL_UINT(2, ListGetLength(myList));
 
-    //ListDestruct
-    MY_RUN_TEST(testListDestruct);
-    MY_RUN_TEST(testListDestruct_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListDestruct_WhenListIsFilled);
-    
-    //ListGetHeadData
-    MY_RUN_TEST(testListGetHeadData);
-    MY_RUN_TEST(testListGetHeadData_WhenListIsNULL_ReturnNULL);
-    MY_RUN_TEST(testListGetHeadData_WhenListIsEmpty_ReturnNULL);
+    ListRemove(myList, &a);
+    TEST_ASSERT_EQUAL_UINT(1, ListGetLength(myList));
 
-    //ListGetTailData
-    MY_RUN_TEST(testListGetTailData);
-    MY_RUN_TEST(testListGetTailData_WhenListIsNULL_ReturnNULL);
-    MY_RUN_TEST(testListGetTailData_WhenListIsEmpty_ReturnNULL);
+    ListClear(myList);
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+}
 
-    //ListGetNextData
-    MY_RUN_TEST(testListGetNextData);
-    MY_RUN_TEST(testListGetNextData_WhenListIsNULL_ReturnNULL);
-    MY_RUN_TEST(testListGetNextData_WhenListIsEmpty_ReturnNULL);
-    MY_RUN_TEST(testListGetNextData_WhenFirstDataIsRequested_ReturnNULL);
-    MY_RUN_TEST(testListGetNextData_WhenDataIsAdded_NextDataIsReturned);
-    MY_RUN_TEST(testListGetNextData_WhenLastAccessedIsDeleted_ReturnNULL);
+void testListGetLength_WhenListIsNULL_ReturnZero(void)
+{
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(NULL));
+}
 
-    //ListGetPreviousData
-    MY_RUN_TEST(testListGetPreviousData);
-    MY_RUN_TEST(testListGetPreviousData_WhenListIsNULL_ReturnNULL);
-    MY_RUN_TEST(testListGetPreviousData_WhenListIsEmpty_ReturnNULL);
-    MY_RUN_TEST(testListGetPreviousData_WhenFirstDataIsRequested_ReturnNULL);
-    MY_RUN_TEST(testListGetPreviousData_WhenDataIsAdded_PreviousDataIsReturned);
-    MY_RUN_TEST(testListGetPreviousData_WhenLastAccessedIsDeleted_ReturnNULL);
+//ListForEachParallel
+static void AddAddress(void* data, void* context)
+{
+    __atomic_fetch_add((int*)context, ((Element*)data)->address, __ATOMIC_RELAXED);
+}
 
-    //ListAddHead
-    MY_RUN_TEST(testListAddHead);
-    MY_RUN_TEST(testListAddHead_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListAddHead_WhenDataIsNULL_Return);
-    MY_RUN_TEST(testListAddHead_WhenListIsEmpty_AddNodeToFrontOfList);
+static void SumAddress(void* accumulator, const void* data, void* context)
+{
+    (void)context;
+    *(long*)accumulator += ((const Element*)data)->address;
+}
 
-    //ListAddTail
-    MY_RUN_TEST(testListAddTail);
-    MY_RUN_TEST(testListAddTail_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListAddTail_WhenDataIsNULL_Return);
-    MY_RUN_TEST(testListAddTail_WhenListIsEmpty_AddNodeToEndOfList);
+static void SumPartial(void* accumulator, const void* partial, void* context)
+{
+    (void)context;
+    *(long*)accumulator += *(const long*)partial;
+}
 
-    //ListAddBefore
-    MY_RUN_TEST(testListAddBefore);
-    MY_RUN_TEST(testListAddBefore_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListAddBefore_WhenDataIsNULL_Return);
-    MY_RUN_TEST(testListAddBefore_WhenRefDataIsNULL_Return);
-    MY_RUN_TEST(testListAddBefore_WhenRefDataIsNotFound_Return);
-    MY_RUN_TEST(testListAddBefore_WhenRefDataIsFirstNode_AddNodeToFrontOfList);
-    MY_RUN_TEST(testListAddBefore_WhenRefDataExist_AddNewNodeBetweenNodes);
+static void AppendDigit(void* accumulator, const void* data, void* context)
+{
+    (void)context;
+    *(long*)accumulator = *(long*)accumulator * 10 + ((const Element*)data)->address;
+}
 
-    //ListAddAfter
-    MY_RUN_TEST(testListAddAfter);
-    MY_RUN_TEST(testListAddAfter_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListAddAfter_WhenDataIsNULL_Return);
-    MY_RUN_TEST(testListAddAfter_WhenRefDataIsNULL_Return);
-    MY_RUN_TEST(testListAddAfter_WhenRefDataIsNotFound_Return);
-    MY_RUN_TEST(testListAddAfter_WhenRefDataIsLastNode_AddNodeToEndOfList);
-    MY_RUN_TEST(testListAddAfter_WhenRefDataExist_AddNewNodeBetweenNodes);
+static void AppendPartial(void* accumulator, const void* partial, void* context)
+{
+    (void)context;
+    long value = *(const long*)partial;
+    long scale = 1;
 
-    //ListRemoveHead
-    MY_RUN_TEST(testListRemoveHead);
-    MY_RUN_TEST(testListRemoveHead_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListRemoveHead_WhenListIsEmpty_Return);
-    
-    //ListRemoveTail
-    MY_RUN_TEST(testListRemoveTail);
-    MY_RUN_TEST(testListRemoveTail_WhenListIsNULL_Return);
-    MY_RUN_TEST(testListRemoveTail_WhenListIsEmpty_Return);
+    while (scale <= value)
+    {
+        scale *= 10;
+    }
 
-    //ListRemove
-    MY_RUN_TEST(testListRemove);
-    MY_RUN_TEST(testListRemove_WhenListIsNull_Return);
-    MY_RUN_TEST(testListRemove_WhenListIsEmpty_Return);
-    MY_RUN_TEST(testListRemove_WhenRefDataIsNull_Return);
+    *(long*)accumulator = *(long*)accumulator * scale + value;
+}
+
+void testListForEachParallel(void)
+{
+    int sum = 0;
+
+    for (int index = 1; index <= 100; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListForEachParallel(myList, AddAddress, &sum, 4));
+    TEST_ASSERT_EQUAL_INT(5050, sum);
+
+    sum = 0;
+    TEST_ASSERT_EQUAL_INT(0, ListForEachParallel(myList, AddAddress, &sum, 0));
+    TEST_ASSERT_EQUAL_INT(5050, sum);
+}
+
+void testListForEachParallel_WhenListChanges_VisitsNewContent(void)
+{
+    Element a = {20};
+    Element b = {240};
+    int sum = 0;
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListForEachParallel(myList, AddAddress, &sum, 2);
+    TEST_ASSERT_EQUAL_INT(260, sum);
+
+    ListRemoveHead(myList);
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &a);
+
+    sum = 0;
+    TEST_ASSERT_EQUAL_INT(0, ListForEachParallel(myList, AddAddress, &sum, 2));
+    TEST_ASSERT_EQUAL_INT(280, sum);
+}
+
+void testListForEachParallel_WhenListIsEmpty_VisitNothing(void)
+{
+    int sum = 0;
+    TEST_ASSERT_EQUAL_INT(0, ListForEachParallel(myList, AddAddress, &sum, 4));
+    TEST_ASSERT_EQUAL_INT(0, sum);
+}
+
+void testListForEachParallel_WhenListIsNULL_Return(void)
+{
+    int sum = 0;
+    TEST_ASSERT_EQUAL_INT(-1, ListForEachParallel(NULL, AddAddress, &sum, 4));
+}
+
+void testListForEachParallel_WhenVisitIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListForEachParallel(myList, NULL, NULL, 4));
+}
+
+//ListReduceParallel
+void testListReduceParallel(void)
+{
+    long sum = 0;
+
+    for (int index = 1; index <= 1000; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListReduceParallel(myList, SumAddress, SumPartial, &sum, sizeof(sum), NULL, 3));
+    TEST_ASSERT_EQUAL_INT(500500, sum);
+}
+
+void testListReduceParallel_CombinesPartialsInListOrder(void)
+{
+    long digits = 0;
+
+    for (int index = 1; index <= 9; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListReduceParallel(myList, AppendDigit, AppendPartial, &digits, sizeof(digits), NULL, 4));
+    TEST_ASSERT_EQUAL_INT(123456789, digits);
+}
+
+void testListReduceParallel_WhenListIsEmpty_KeepIdentity(void)
+{
+    long sum = 7;
+    TEST_ASSERT_EQUAL_INT(0, ListReduceParallel(myList, SumAddress, SumPartial, &sum, sizeof(sum), NULL, 4));
+    TEST_ASSERT_EQUAL_INT(7, sum);
+}
+
+void testListReduceParallel_WhenArgumentIsNULL_Return(void)
+{
+    long sum = 0;
+    TEST_ASSERT_EQUAL_INT(-1, ListReduceParallel(NULL, SumAddress, SumPartial, &sum, sizeof(sum), NULL, 4));
+    TEST_ASSERT_EQUAL_INT(-1, ListReduceParallel(myList, NULL, SumPartial, &sum, sizeof(sum), NULL, 4));
+    TEST_ASSERT_EQUAL_INT(-1, ListReduceParallel(myList, SumAddress, NULL, &sum, sizeof(sum), NULL, 4));
+    TEST_ASSERT_EQUAL_INT(-1, ListReduceParallel(myList, SumAddress, SumPartial, NULL, sizeof(sum), NULL, 4));
+    TEST_ASSERT_EQUAL_INT(-1, ListReduceParallel(myList, SumAddress, SumPartial, &sum, 0, NULL, 4));
+}
+
+//ListSnapshot
+void testListSnapshot(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+    Element d = {760};
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListAddTail(myList, &c);
+
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+    TEST_ASSERT_NOT_NULL(snapshot);
+
+    ListRemove(myList, &b);
+    ListAddHead(myList, &d);
+
+    TEST_ASSERT_EQUAL_UINT(3, ListSnapshotGetLength(snapshot));
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetHeadData(snapshot))->address);
+    TEST_ASSERT_EQUAL_INT(240, ((const Element*)ListSnapshotGetNextData(snapshot))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((const Element*)ListSnapshotGetNextData(snapshot))->address);
+    TEST_ASSERT_NULL(ListSnapshotGetNextData(snapshot));
+
+    TEST_ASSERT_EQUAL_UINT(3, ListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(760, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetNextData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetNextData(myList))->address);
+    TEST_ASSERT_NULL(ListGetNextData(myList));
+
+    TEST_ASSERT_EQUAL_INT(0, ListSnapshotRelease(&snapshot));
+    TEST_ASSERT_NULL(snapshot);
+}
+
+void testListSnapshot_WhenListIsNULL_ReturnNULL(void)
+{
+    List* newList = NULL;
+    TEST_ASSERT_NULL(ListSnapshot(newList));
+}
+
+void testListSnapshot_WhenListIsCleared_KeepsTailAndPrevious(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    ListClear(myList);
+    ListAddTail(myList, &c);
+
+    TEST_ASSERT_EQUAL_INT(240, ((const Element*)ListSnapshotGetTailData(snapshot))->address);
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetPreviousData(snapshot))->address);
+    TEST_ASSERT_NULL(ListSnapshotGetPreviousData(snapshot));
+
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetTailData(myList))->address);
+    TEST_ASSERT_NULL(ListGetPreviousData(myList));
+
+    ListSnapshotRelease(&snapshot);
+}
+
+void testListSnapshot_WhenReleased_ListKeepsWorking(void)
+{
+    for (int index = 0; index < 12; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    ListSnapshotHandle* first = ListSnapshot(myList);
+    ListRemoveHead(myList);
+    ListSnapshotHandle* second = ListSnapshot(myList);
+    ListRemoveTail(myList);
+
+    TEST_ASSERT_EQUAL_INT(0, ((const Element*)ListSnapshotGetHeadData(first))->address);
+    TEST_ASSERT_EQUAL_INT(1, ((const Element*)ListSnapshotGetHeadData(second))->address);
+    TEST_ASSERT_EQUAL_INT(11, ((const Element*)ListSnapshotGetTailData(second))->address);
+
+    ListSnapshotRelease(&first);
+    ListSnapshotRelease(&second);
+
+    Element element = {100};
+    ListAddHead(myList, &element);
+    ListRemoveTail(myList);
+
+    TEST_ASSERT_EQUAL_UINT(10, ListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(100, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(1, ((Element*)ListGetNextData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(9, ((Element*)ListGetTailData(myList))->address);
+}
+
+void testListSnapshot_WhenListIsDestructed_SnapshotStaysReadable(void)
+{
+    Element a = {20};
+    List* newList = ListConstruct(sizeof(Element));
+
+    ListAddTail(newList, &a);
+    ListSnapshotHandle* snapshot = ListSnapshot(newList);
+    ListDestruct(&newList);
+
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetHeadData(snapshot))->address);
+    TEST_ASSERT_EQUAL_INT(0, ListSnapshotRelease(&snapshot));
+}
+
+void testListSnapshot_WhenParallelScanRuns_SkipRemovedElements(void)
+{
+    int sum = 0;
+
+    for (int index = 1; index <= 10; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    for (int index = 2; index <= 10; index += 2)
+    {
+        Element element = {index};
+        ListRemove(myList, &element);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListForEachParallel(myList, AddAddress, &sum, 3));
+    TEST_ASSERT_EQUAL_INT(25, sum);
+
+    ListSnapshotRelease(&snapshot);
+}
+
+typedef struct snapshot_reader SnapshotReader;
+struct snapshot_reader
+{
+    ListSnapshotHandle* snapshot;
+    int failures;
+};
+
+static void* ReadSnapshot(void* argument)
+{
+    SnapshotReader* reader = argument;
+
+    for (int round = 0; round < 200; round++)
+    {
+        int expected = 0;
+
+        for (const Element* elementPtr = ListSnapshotGetHeadData(reader->snapshot); elementPtr != NULL;
+             elementPtr = ListSnapshotGetNextData(reader->snapshot))
+        {
+            reader->failures += elementPtr->address != expected++;
+        }
+
+        reader->failures += expected != 100;
+    }
+
+    return NULL;
+}
+
+void testListSnapshot_WhenWriterRunsConcurrently_ViewStaysConsistent(void)
+{
+    for (int index = 0; index < 100; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    SnapshotReader reader = {ListSnapshot(myList), 0};
+    pthread_t thread;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, ReadSnapshot, &reader));
+
+    for (int index = 0; index < 2000; index++)
+    {
+        Element element = {1000 + index};
+
+        ListAddHead(myList, &element);
+        ListAddTail(myList, &element);
+        ListRemoveHead(myList);
+        ListRemove(myList, &element);
+        ListRemoveHead(myList);
+        ListAddTail(myList, &element);
+    }
+
+    pthread_join(thread, NULL);
+    TEST_ASSERT_EQUAL_INT(0, reader.failures);
+    ListSnapshotRelease(&reader.snapshot);
+}
+
+//ListSnapshotRelease
+void testListSnapshotRelease_WhenSnapshotIsNULL_Return(void)
+{
+    ListSnapshotHandle* snapshot = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, ListSnapshotRelease(&snapshot));
+    TEST_ASSERT_EQUAL_INT(-1, ListSnapshotRelease(NULL));
+    TEST_ASSERT_NULL(ListSnapshotGetHeadData(NULL));
+    TEST_ASSERT_EQUAL_UINT(0, ListSnapshotGetLength(NULL));
+}
+
+//ListEnableRcu
+void testListEnableRcu(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+    EpochDomain* domain = EpochDomainConstruct();
+    EpochReader* reader = EpochReaderRegister(domain);
+
+    TEST_ASSERT_EQUAL_INT(0, ListEnableRcu(myList, domain));
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListAddTail(myList, &c);
+
+    EpochEnter(reader);
+    const Element* elementPtr = ListRcuGetHeadData(myList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    elementPtr = ListRcuGetNextData(myList, elementPtr);
+    TEST_ASSERT_EQUAL_INT(240, elementPtr->address);
+
+    ListRemove(myList, &b);
+    EpochReclaim(domain);
+    TEST_ASSERT_EQUAL_UINT(1, EpochGetPendingCount(domain));
+
+    elementPtr = ListRcuGetNextData(myList, elementPtr);
+    TEST_ASSERT_EQUAL_INT(60, elementPtr->address);
+    TEST_ASSERT_NULL(ListRcuGetNextData(myList, elementPtr));
+    EpochExit(reader);
+
+    EpochSynchronize(domain);
+    TEST_ASSERT_EQUAL_UINT(0, EpochGetPendingCount(domain));
+
+    ListDestruct(&myList);
+    EpochReaderUnregister(&reader);
+    TEST_ASSERT_EQUAL_INT(0, EpochDomainDestruct(&domain));
+}
+
+void testListEnableRcu_WhenListIsNotEmpty_Return(void)
+{
+    Element a = {20};
+
+    ListAddTail(myList, &a);
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableRcu(myList, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableRcu(NULL, NULL));
+}
+
+void testListEnableRcu_WhenDomainIsNULL_UseDefaultDomain(void)
+{
+    Element a = {20};
+
+    TEST_ASSERT_EQUAL_INT(0, ListEnableRcu(myList, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableRcu(myList, NULL));
+
+    ListAddTail(myList, &a);
+    ListClear(myList);
+    TEST_ASSERT_TRUE(EpochGetPendingCount(EpochDomainGetDefault()) > 0);
+}
+
+void testListRcuGetHeadData_WhenListIsNULL_ReturnNULL(void)
+{
+    Element a = {20};
+
+    TEST_ASSERT_NULL(ListRcuGetHeadData(NULL));
+    TEST_ASSERT_NULL(ListRcuGetHeadData(myList));
+    TEST_ASSERT_NULL(ListRcuGetNextData(myList, NULL));
+    TEST_ASSERT_NULL(ListRcuGetNextData(NULL, &a));
+}
+
+typedef struct rcu_reader RcuReader;
+struct rcu_reader
+{
+    List* list;
+    EpochReader* reader;
+    int stop;
+    int failures;
+};
+
+static void* ReadRcuList(void* argument)
+{
+    RcuReader* rcuReader = argument;
+
+    while (!__atomic_load_n(&rcuReader->stop, __ATOMIC_ACQUIRE))
+    {
+        int previous = -1;
+
+        EpochEnter(rcuReader->reader);
+
+        for (const Element* elementPtr = ListRcuGetHeadData(rcuReader->list); elementPtr != NULL;
+             elementPtr = ListRcuGetNextData(rcuReader->list, elementPtr))
+        {
+            rcuReader->failures += elementPtr->address <= previous;
+            previous = elementPtr->address;
+        }
+
+        EpochExit(rcuReader->reader);
+    }
+
+    return NULL;
+}
+
+void testListRcu_WhenWriterRunsConcurrently_ReadersSeeOrderedElements(void)
+{
+    EpochDomain* domain = EpochDomainConstruct();
+    RcuReader rcuReader = {myList, EpochReaderRegister(domain), 0, 0};
+    pthread_t thread;
+
+    ListEnableRcu(myList, domain);
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, ReadRcuList, &rcuReader));
+
+    for (int index = 0; index < 20000; index++)
+    {
+        Element element = {index};
+
+        ListAddTail(myList, &element);
+
+        if (index % 3 != 0)
+        {
+            ListRemoveHead(myList);
+        }
+    }
+
+    __atomic_store_n(&rcuReader.stop, 1, __ATOMIC_RELEASE);
+    pthread_join(thread, NULL);
+    TEST_ASSERT_EQUAL_INT(0, rcuReader.failures);
+
+    ListDestruct(&myList);
+    EpochReaderUnregister(&rcuReader.reader);
+    EpochDomainDestruct(&domain);
+}
+
+//ListConstructVariable
+void testListConstructVariable(void)
+{
+    List* newList = ListConstructVariable();
+    TEST_ASSERT_NOT_NULL(newList);
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(newList));
+
+    TEST_ASSERT_EQUAL_INT(0, ListDestruct(&newList));
+}
+
+//ListAddTailVariable
+void testListAddTailVariable(void)
+{
+    List* newList = ListConstructVariable();
+    const char* words[] = {"a", "variable", "", "length list"};
+
+    for (int index = 0; index < 4; index++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, ListAddTailVariable(newList, words[index], strlen(words[index])));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListAddHeadVariable(newList, "head", 4));
+
+    const char* data = ListGetHeadData(newList);
+    TEST_ASSERT_EQUAL_UINT(4, ListGetDataLength(newList, data));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("head", data, 4));
+
+    for (int index = 0; index < 4; index++)
+    {
+        data = ListGetNextData(newList);
+        TEST_ASSERT_EQUAL_UINT(strlen(words[index]), ListGetDataLength(newList, data));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(words[index], data, strlen(words[index])));
+    }
+
+    TEST_ASSERT_NULL(ListGetNextData(newList));
+    ListDestruct(&newList);
+}
+
+void testListAddTailVariable_WhenElementsSpanSlabs_KeepData(void)
+{
+    List* newList = ListConstructVariable();
+    char buffer[300];
+
+    for (int index = 0; index < 300; index++)
+    {
+        memset(buffer, 'a' + index % 26, (size_t)index);
+        ListAddHeadVariable(newList, buffer, (size_t)index);
+    }
+
+    int index = 299;
+
+    for (const char* data = ListGetHeadData(newList); data != NULL; data = ListGetNextData(newList), index--)
+    {
+        TEST_ASSERT_EQUAL_UINT(index, ListGetDataLength(newList, data));
+        TEST_ASSERT_TRUE(index == 0 || (data[0] == 'a' + index % 26 && data[index - 1] == data[0]));
+    }
+
+    TEST_ASSERT_EQUAL_INT(-1, index);
+    ListDestruct(&newList);
+}
+
+void testListAddTailVariable_WhenListHasFixedSize_Return(void)
+{
+    Element a = {20};
+
+    TEST_ASSERT_EQUAL_INT(-1, ListAddTailVariable(myList, &a, sizeof(a)));
+    TEST_ASSERT_EQUAL_INT(-1, ListAddHeadVariable(myList, &a, sizeof(a)));
+    TEST_ASSERT_EQUAL_INT(-1, ListAddTailVariable(NULL, &a, sizeof(a)));
+}
+
+void testListAddTailVariable_WhenDataHasFixedSize_Return(void)
+{
+    List* newList = ListConstructVariable();
+    Element a = {20};
+
+    TEST_ASSERT_EQUAL_INT(-1, ListAddTail(newList, &a));
+    TEST_ASSERT_EQUAL_INT(-1, ListAdoptTail(newList, &a));
+    TEST_ASSERT_NULL(ListEmplaceTail(newList));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableRcu(newList, NULL));
+
+    ListAddTailVariable(newList, &a, sizeof(a));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemove(newList, &a));
+    TEST_ASSERT_NULL(ListDetachHead(newList));
+    TEST_ASSERT_EQUAL_UINT(1, ListGetLength(newList));
+
+    ListDestruct(&newList);
+}
+
+//ListRemoveVariable
+void testListRemoveVariable(void)
+{
+    List* newList = ListConstructVariable();
+
+    ListAddTailVariable(newList, "abc", 3);
+    ListAddTailVariable(newList, "abcd", 4);
+    ListAddTailVariable(newList, "abd", 3);
+
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveVariable(newList, "ab", 2));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveVariable(newList, "abcd", 4));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveVariable(newList, "abd", 3));
+
+    const char* data = ListGetHeadData(newList);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("abc", data, 3));
+    TEST_ASSERT_NULL(ListGetNextData(newList));
+
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveVariable(newList, NULL, 3));
+    ListDestruct(&newList);
+}
+
+void testListRemoveVariable_WhenSnapshotIsAlive_SnapshotKeepsData(void)
+{
+    List* newList = ListConstructVariable();
+
+    ListAddTailVariable(newList, "first", 5);
+    ListSnapshotHandle* snapshot = ListSnapshot(newList);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveVariable(newList, "first", 5));
+    ListDestruct(&newList);
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp("first", ListSnapshotGetHeadData(snapshot), 5));
+    ListSnapshotRelease(&snapshot);
+}
+
+//ListGetDataLength
+void testListGetDataLength_WhenListHasFixedSize_ReturnDataSize(void)
+{
+    Element a = {20};
+
+    ListAddTail(myList, &a);
+    TEST_ASSERT_EQUAL_UINT(sizeof(Element), ListGetDataLength(myList, ListGetHeadData(myList)));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetDataLength(myList, NULL));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetDataLength(NULL, &a));
+}
+
+//ListEnableFilter
+void testListEnableFilter(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, ListEnableFilter(myList, 16));
+
+    for (int address = 0; address < 200; address++)
+    {
+        Element a = {address};
+        ListAddTail(myList, &a);
+    }
+
+    for (int address = 0; address < 200; address += 2)
+    {
+        Element a = {address};
+        TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &a));
+        TEST_ASSERT_EQUAL_INT(-1, ListRemove(myList, &a));
+    }
+
+    Element a = {1};
+    Element b = {1000};
+    TEST_ASSERT_EQUAL_INT(0, ListAddAfter(myList, &b, &a));
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &b));
+    TEST_ASSERT_EQUAL_UINT(100, ListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(1, ((Element*)ListGetHeadData(myList))->address);
+}
+
+void testListEnableFilter_WhenSearchesMiss_StayWithinTimeBudget(void)
+{
+    ListEnableFilter(myList, 10000);
+
+    for (int address = 0; address < 10000; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    /* Without the filter every run compares 10 million elements; with it, about 1% of the misses walk. */
+    TEST_BENCHMARK_BELOW_NS(5, 10000000,
+        for (int address = 10000; address < 11000; address++)
+        {
+            Element a = {address};
+            ListRemove(myList, &a);
+        });
+    TEST_ASSERT_EQUAL_UINT(10000, ListGetLength(myList));
+}
+
+void testListEnableFilter_WhenListIsNotEmpty_CountExistingElements(void)
+{
+    Element a = {20};
+    Element b = {240};
+
+    ListAddTail(myList, &a);
+    ListAdoptTail(myList, NewElement(60));
+    TEST_ASSERT_EQUAL_INT(0, ListEnableFilter(myList, 0));
+    ListAddTail(myList, &b);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &a));
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &b));
+
+    Element* detached = ListDetachHead(myList);
+    TEST_ASSERT_EQUAL_INT(60, detached->address);
+    TEST_ASSERT_EQUAL_INT(-1, ListRemove(myList, detached));
+    free(detached);
+}
+
+void testListEnableFilter_WhenListIsCleared_ForgetElements(void)
+{
+    Element a = {20};
+
+    ListEnableFilter(myList, 8);
+    ListAddTail(myList, &a);
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    ListClear(myList);
+    TEST_ASSERT_EQUAL_INT(-1, ListRemove(myList, &a));
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetHeadData(snapshot))->address);
+    ListSnapshotRelease(&snapshot);
+
+    ListAddTail(myList, &a);
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &a));
+}
+
+void testListEnableFilter_WhenListIsVariable_FilterLengthAndBytes(void)
+{
+    List* newList = ListConstructVariable();
+
+    ListEnableFilter(newList, 8);
+    ListAddTailVariable(newList, "abc", 3);
+    ListAddTailVariable(newList, "abcd", 4);
+
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveVariable(newList, "ab", 2));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveVariable(newList, "abcd", 4));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveVariable(newList, "abcd", 4));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveVariable(newList, "abc", 3));
+
+    ListDestruct(&newList);
+}
+
+void testListEnableFilter_WhenArgumentIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableFilter(NULL, 8));
+
+    ListEnableFilter(myList, 8);
+    TEST_ASSERT_NULL(ListEmplaceHead(myList));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+}
+
+//ListEnableIndex
+void testListEnableIndex(void)
+{
+    for (int address = 0; address < 100; address++)
+    {
+        Element a = {address};
+        ListAddTail(myList, &a);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListEnableIndex(myList));
+    TEST_ASSERT_EQUAL_INT(0, ListEnableIndex(myList));
+
+    for (int address = 0; address < 100; address++)
+    {
+        TEST_ASSERT_EQUAL_INT(address, ((Element*)ListGetAt(myList, (size_t)address))->address);
+    }
+
+    TEST_ASSERT_NULL(ListGetAt(myList, 100));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableIndex(NULL));
+}
+
+void testListEnableIndex_WhenListChanges_MatchReferenceArray(void)
+{
+    int reference[512];
+    size_t length = 0;
+
+    ListEnableIndex(myList);
+    srand(7);
+
+    for (int step = 0; step < 4000; step++)
+    {
+        int choice = rand() % 4;
+        Element a = {step};
+
+        if (choice < 2 && length < 512)
+        {
+            size_t position = (size_t)rand() % (length + 1);
+            TEST_ASSERT_EQUAL_INT(0, ListInsertAt(myList, position, &a));
+            memmove(reference + position + 1, reference + position, (length - position) * sizeof(int));
+            reference[position] = step;
+            length++;
+        }
+        else if (choice == 2 && length > 0)
+        {
+            size_t position = (size_t)rand() % length;
+            TEST_ASSERT_EQUAL_INT(0, ListRemoveAt(myList, position));
+            memmove(reference + position, reference + position + 1, (length - position - 1) * sizeof(int));
+            length--;
+        }
+        else if (choice == 3 && length > 0 && length < 512)
+        {
+            size_t position = (size_t)rand() % length;
+            Element b = {reference[position]};
+            TEST_ASSERT_EQUAL_INT(0, ListAddBefore(myList, &a, &b));
+            memmove(reference + position + 1, reference + position, (length - position) * sizeof(int));
+            reference[position] = step;
+            length++;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT(length, ListGetLength(myList));
+
+    for (size_t position = 0; position < length; position++)
+    {
+        TEST_ASSERT_EQUAL_INT(reference[position], ((Element*)ListGetAt(myList, position))->address);
+    }
+}
+
+void testListEnableIndex_WhenSnapshotIsAlive_IndexLiveElementsOnly(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+
+    ListEnableIndex(myList);
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveAt(myList, 0));
+    TEST_ASSERT_EQUAL_INT(0, ListAddBefore(myList, &c, &b));
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetAt(myList, 0))->address);
+    TEST_ASSERT_EQUAL_INT(240, ((Element*)ListGetAt(myList, 1))->address);
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetHeadData(snapshot))->address);
+
+    ListClear(myList);
+    TEST_ASSERT_NULL(ListGetAt(myList, 0));
+    ListSnapshotRelease(&snapshot);
+
+    ListAddHead(myList, &a);
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetAt(myList, 0))->address);
+}
+
+//ListGetAt
+void testListGetAt_WhenIndexIsDisabled_WalkAndMoveCursor(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListAddTail(myList, &c);
+
+    TEST_ASSERT_EQUAL_INT(240, ((Element*)ListGetAt(myList, 1))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetNextData(myList))->address);
+    TEST_ASSERT_NULL(ListGetAt(myList, 3));
+    TEST_ASSERT_NULL(ListGetAt(NULL, 0));
+}
+
+void testListGetAt_WhenIndexIsEnabled_StayWithinTimeBudget(void)
+{
+    for (int address = 0; address < 100000; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    ListEnableIndex(myList);
+
+    /* Walking would visit 50 million nodes per run; the index visits a few dozen per lookup. */
+    TEST_BENCHMARK_BELOW_NS(5, 20000000,
+        for (size_t position = 0; position < 100000; position += 100)
+        {
+            TEST_ASSERT_EQUAL_INT(99999 - (int)position, ((Element*)ListGetAt(myList, position))->address);
+        });
+}
+
+//ListInsertAt
+void testListInsertAt(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+
+    TEST_ASSERT_EQUAL_INT(0, ListInsertAt(myList, 0, &a));
+    TEST_ASSERT_EQUAL_INT(0, ListInsertAt(myList, 1, &b));
+    TEST_ASSERT_EQUAL_INT(0, ListInsertAt(myList, 1, &c));
+
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetNextData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(240, ((Element*)ListGetNextData(myList))->address);
+}
+
+void testListInsertAt_WhenArgumentIsInvalid_Return(void)
+{
+    Element a = {20};
+
+    TEST_ASSERT_EQUAL_INT(-1, ListInsertAt(myList, 1, &a));
+    TEST_ASSERT_EQUAL_INT(-1, ListInsertAt(myList, 0, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ListInsertAt(NULL, 0, &a));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+}
+
+//ListRemoveAt
+void testListRemoveAt(void)
+{
+    Element a = {20};
+    Element b = {240};
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveAt(myList, 2));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveAt(myList, 1));
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetTailData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveAt(myList, 0));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveAt(myList, 0));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveAt(NULL, 0));
+}
+
+//ListAddTailH
+void testListAddTailH(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+
+    ListHandle handleB = ListAddTailH(myList, &b);
+    ListHandle handleC = ListAddTailH(myList, &c);
+    ListHandle handleA = ListAddHeadH(myList, &a);
+
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetHandleData(myList, handleA))->address);
+    TEST_ASSERT_EQUAL_INT(240, ((Element*)ListGetHandleData(myList, handleB))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetHandleData(myList, handleC))->address);
+    TEST_ASSERT_TRUE(ListGetHeadData(myList) == ListGetHandleData(myList, handleA));
+    TEST_ASSERT_TRUE(ListGetTailData(myList) == ListGetHandleData(myList, handleC));
+}
+
+void testListAddTailH_WhenArgumentIsInvalid_ReturnNULLHandle(void)
+{
+    Element a = {20};
+    List* newList = ListConstruct(sizeof(Element));
+
+    TEST_ASSERT_NULL(ListAddTailH(NULL, &a).node);
+    TEST_ASSERT_NULL(ListAddTailH(myList, NULL).node);
+
+    ListEnableRcu(newList, NULL);
+    TEST_ASSERT_NULL(ListAddHeadH(newList, &a).node);
+    ListDestruct(&newList);
+
+    ListAddTailH(myList, &a);
+    ListClear(myList);
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableRcu(myList, NULL));
+}
+
+//ListInsertAfterHandle
+void testListInsertAfterHandle(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+
+    ListHandle handleA = ListAddTailH(myList, &a);
+    ListAddTailH(myList, &c);
+    ListHandle handleB = ListInsertAfterHandle(myList, handleA, &b);
+
+    TEST_ASSERT_NOT_NULL(handleB.node);
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(240, ((Element*)ListGetNextData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(60, ((Element*)ListGetNextData(myList))->address);
+
+    ListRemoveHandle(myList, handleA);
+    TEST_ASSERT_NULL(ListInsertAfterHandle(myList, handleA, &b).node);
+    TEST_ASSERT_EQUAL_UINT(2, ListGetLength(myList));
+}
+
+//ListRemoveHandle
+void testListRemoveHandle(void)
+{
+    Element a = {20};
+    Element b = {240};
+
+    ListHandle handleA = ListAddTailH(myList, &a);
+    ListHandle handleB = ListAddTailH(myList, &b);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveHandle(myList, handleB));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveHandle(myList, handleB));
+    TEST_ASSERT_NULL(ListGetHandleData(myList, handleB));
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetTailData(myList))->address);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(myList, &a));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveHandle(myList, handleA));
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveHandle(NULL, handleA));
+}
+
+void testListRemoveHandle_WhenNodeIsReused_DetectStaleHandle(void)
+{
+    ListHandle handles[32];
+
+    for (int address = 0; address < 32; address++)
+    {
+        Element a = {address};
+        handles[address] = ListAddTailH(myList, &a);
+    }
+
+    ListClear(myList);
+
+    for (int address = 0; address < 32; address++)
+    {
+        Element a = {100 + address};
+        ListHandle handle = ListAddTailH(myList, &a);
+
+        TEST_ASSERT_NULL(ListGetHandleData(myList, handles[address]));
+        TEST_ASSERT_EQUAL_INT(-1, ListRemoveHandle(myList, handles[address]));
+        TEST_ASSERT_EQUAL_INT(100 + address, ((Element*)ListGetHandleData(myList, handle))->address);
+    }
+
+    TEST_ASSERT_EQUAL_UINT(32, ListGetLength(myList));
+}
+
+void testListRemoveHandle_WhenSnapshotIsAlive_HandleIsStaleAtOnce(void)
+{
+    Element a = {20};
+
+    ListHandle handle = ListAddTailH(myList, &a);
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveHandle(myList, handle));
+    TEST_ASSERT_NULL(ListGetHandleData(myList, handle));
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetHeadData(snapshot))->address);
+
+    ListSnapshotRelease(&snapshot);
+    TEST_ASSERT_EQUAL_INT(-1, ListRemoveHandle(myList, handle));
+}
+
+//ListClearAsync
+void testListClearAsync(void)
+{
+    for (int address = 0; address < 100; address++)
+    {
+        Element a = {address};
+
+        if (address % 3 == 0)
+        {
+            ListAdoptTail(myList, NewElement(address));
+        }
+        else
+        {
+            ListAddHead(myList, &a);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ListClearAsync(myList));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+    TEST_ASSERT_NULL(ListGetHeadData(myList));
+
+    for (int address = 0; address < 20; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    TEST_ASSERT_EQUAL_INT(19, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(0, ((Element*)ListGetTailData(myList))->address);
+    TEST_ASSERT_EQUAL_UINT(20, ListGetLength(myList));
+    ListReclaimerDrain();
+}
+
+void testListClearAsync_WhenSnapshotIsAlive_ClearSynchronously(void)
+{
+    Element a = {20};
+
+    ListAddTail(myList, &a);
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    TEST_ASSERT_EQUAL_INT(0, ListClearAsync(myList));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(20, ((const Element*)ListSnapshotGetHeadData(snapshot))->address);
+
+    ListSnapshotRelease(&snapshot);
+    TEST_ASSERT_EQUAL_INT(-1, ListClearAsync(NULL));
+}
+
+//ListDestructAsync
+void testListDestructAsync(void)
+{
+    List* newList = ListConstruct(sizeof(Element));
+    List* variableList = ListConstructVariable();
+
+    for (int address = 0; address < 1000; address++)
+    {
+        Element a = {address};
+        ListAddHead(newList, &a);
+        ListAddHeadVariable(variableList, &a, sizeof(a));
+    }
+
+    ListAdoptHead(newList, NewElement(1000));
+    ListEnableIndex(newList);
+
+    TEST_ASSERT_EQUAL_INT(0, ListDestructAsync(&newList));
+    TEST_ASSERT_NULL(newList);
+    TEST_ASSERT_EQUAL_INT(0, ListDestructAsync(&variableList));
+    TEST_ASSERT_NULL(variableList);
+    ListReclaimerDrain();
+}
+
+void testListDestructAsync_WhenArgumentIsNULL_Return(void)
+{
+    List* newList = NULL;
+
+    TEST_ASSERT_EQUAL_INT(-1, ListDestructAsync(&newList));
+    TEST_ASSERT_EQUAL_INT(-1, ListDestructAsync(NULL));
+}
+
+//ListReclaimerConfigure
+void testListReclaimerConfigure(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListReclaimerConfigure(0, 10));
+    TEST_ASSERT_EQUAL_INT(0, ListReclaimerConfigure(16, 10));
+
+    for (int address = 0; address < 200; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    ListClearAsync(myList);
+    ListReclaimerDrain();
+    TEST_ASSERT_EQUAL_INT(0, ListReclaimerConfigure(4096, 100));
+}
+
+//ListEnableHugePages
+void testListEnableHugePages(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, ListReserve(myList, 100));
+    TEST_ASSERT_EQUAL_INT(0, ListEnableHugePages(myList));
+    TEST_ASSERT_EQUAL_INT(0, ListEnableHugePages(myList));
+
+    for (int address = 0; address < 4000; address++)
+    {
+        Element a = {address};
+
+        if (address % 1000 == 0)
+        {
+            ListAdoptHead(myList, NewElement(address));
+        }
+        else
+        {
+            ListAddHead(myList, &a);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT(4000, ListGetLength(myList));
+    TEST_ASSERT_EQUAL_INT(3999, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(0, ((Element*)ListGetTailData(myList))->address);
+
+    Element* removedData = ListGetHeadData(myList);
+
+    for (int address = 0; address < 2000; address++)
+    {
+        ListRemoveHead(myList);
+    }
+
+    for (int address = 0; address < 2000; address++)
+    {
+        Element a = {-address};
+        ListAddHead(myList, &a);
+    }
+
+    TEST_ASSERT_TRUE(ListGetHeadData(myList) == removedData);
+    TEST_ASSERT_EQUAL_INT(-1999, ((Element*)ListGetHeadData(myList))->address);
+    TEST_ASSERT_EQUAL_INT(0, ((Element*)ListGetTailData(myList))->address);
+
+    TEST_ASSERT_EQUAL_INT(0, ListClearAsync(myList));
+    TEST_ASSERT_EQUAL_UINT(0, ListGetLength(myList));
+}
+
+void testListEnableHugePages_WhenListIsVariable_KeepPayloadsInArena(void)
+{
+    List* newList = ListConstructVariable();
+    char text[32];
+
+    TEST_ASSERT_EQUAL_INT(0, ListEnableHugePages(newList));
+
+    for (int index = 0; index < 1000; index++)
+    {
+        int length = snprintf(text, sizeof(text), "element %d", index);
+        ListAddTailVariable(newList, text, (size_t)length + 1);
+    }
+
+    TEST_ASSERT_EQUAL_STRING("element 0", ListGetHeadData(newList));
+    TEST_ASSERT_EQUAL_STRING("element 999", ListGetTailData(newList));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveVariable(newList, "element 500", 12));
+    TEST_ASSERT_EQUAL_UINT(999, ListGetLength(newList));
+
+    TEST_ASSERT_EQUAL_INT(0, ListDestructAsync(&newList));
+    TEST_ASSERT_NULL(newList);
+}
+
+void testListEnableHugePages_WhenModeIsIncompatible_Return(void)
+{
+    Element a = {20};
+    List* rcuList = ListConstruct(sizeof(Element));
+
+    TEST_ASSERT_EQUAL_INT(0, ListEnableRcu(rcuList, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableHugePages(rcuList));
+    ListDestruct(&rcuList);
+
+    ListAddHead(myList, &a);
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableHugePages(myList));
+    ListClear(myList);
+    TEST_ASSERT_EQUAL_INT(0, ListEnableHugePages(myList));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableRcu(myList, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ListEnableHugePages(NULL));
+}
+
+//ListConstructView
+static void AssertAddresses(List* list, const int* expected, size_t count)
+{
+    Element* element = ListGetHeadData(list);
+
+    TEST_ASSERT_EQUAL_UINT(count, ListGetLength(list));
+
+    for (size_t index = 0; index < count; index++)
+    {
+        TEST_ASSERT_NOT_NULL(element);
+        TEST_ASSERT_EQUAL_INT(expected[index], element->address);
+        element = ListGetNextData(list);
+    }
+
+    TEST_ASSERT_NULL(element);
+}
+
+void testListConstructView(void)
+{
+    Element records[5] = {{10}, {11}, {12}, {13}, {14}};
+    Element a = {20};
+    Element b = {12};
+    List* view = ListConstructView(records, 5, sizeof(Element));
+
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_TRUE(ListGetHeadData(view) == &records[0]);
+    TEST_ASSERT_TRUE(ListGetTailData(view) == &records[4]);
+    AssertAddresses(view, (const int[]){10, 11, 12, 13, 14}, 5);
+
+    TEST_ASSERT_EQUAL_INT(0, ListAddAfter(view, &a, &b));
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(view, &b));
+    TEST_ASSERT_EQUAL_INT(0, ListRemoveTail(view));
+    AssertAddresses(view, (const int[]){10, 11, 20, 13}, 4);
+
+    Element* detached = ListDetachHead(view);
+    TEST_ASSERT_TRUE(detached != &records[0]);
+    TEST_ASSERT_EQUAL_INT(10, detached->address);
+    free(detached);
+
+    records[1].address = 111;
+    TEST_ASSERT_EQUAL_INT(111, ((Element*)ListGetHeadData(view))->address);
+
+    TEST_ASSERT_EQUAL_INT(0, ListDestructAsync(&view));
+    TEST_ASSERT_NULL(view);
+    TEST_ASSERT_EQUAL_INT(12, records[2].address);
+    TEST_ASSERT_EQUAL_INT(14, records[4].address);
+}
+
+void testListConstructView_WhenSnapshotIsAlive_KeepRemovedElements(void)
+{
+    Element records[3] = {{1}, {2}, {3}};
+    List* view = ListConstructView(records, 3, sizeof(Element));
+
+    ListSnapshotHandle* snapshot = ListSnapshot(view);
+    ListClear(view);
+    TEST_ASSERT_EQUAL_UINT(3, ListSnapshotGetLength(snapshot));
+    TEST_ASSERT_TRUE(ListSnapshotGetTailData(snapshot) == &records[2]);
+
+    ListSnapshotRelease(&snapshot);
+    ListDestruct(&view);
+}
+
+void testListConstructView_WhenArgumentIsInvalid_ReturnNULL(void)
+{
+    Element records[2] = {{1}, {2}};
+    Element a = {20};
+
+    TEST_ASSERT_NULL(ListConstructView(records, 2, 0));
+    TEST_ASSERT_NULL(ListConstructView(NULL, 2, sizeof(Element)));
+
+    List* view = ListConstructView(NULL, 0, sizeof(Element));
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL_INT(0, ListAddHead(view, &a));
+    TEST_ASSERT_EQUAL_UINT(1, ListGetLength(view));
+    ListDestruct(&view);
+}
+
+//ListMoveToHead
+void testListMoveToHead(void)
+{
+    Element records[4] = {{0}, {1}, {2}, {3}};
+    Element a = {2};
+    Element b = {20};
+    List* view = ListConstructView(records, 4, sizeof(Element));
+
+    ListEnableIndex(view);
+    ListEnableFilter(view, 16);
+    ListHandle handle = ListAddTailH(view, &b);
+
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToHead(view, &a));
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToHead(view, &b));
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToHead(view, &b));
+    AssertAddresses(view, (const int[]){20, 2, 0, 1, 3}, 5);
+    TEST_ASSERT_TRUE(ListGetAt(view, 1) == &records[2]);
+    TEST_ASSERT_TRUE(ListGetAt(view, 4) == &records[3]);
+    TEST_ASSERT_EQUAL_INT(20, ((Element*)ListGetHandleData(view, handle))->address);
+
+    b.address = 99;
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToHead(view, &b));
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToHead(view, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToHead(NULL, &a));
+    ListDestruct(&view);
+}
+
+void testListMoveToHead_WhenSnapshotIsAlive_Return(void)
+{
+    Element a = {1};
+    Element b = {2};
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToHead(myList, &b));
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToTail(myList, &a));
+
+    ListSnapshotRelease(&snapshot);
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToHead(myList, &b));
+    TEST_ASSERT_EQUAL_INT(2, ((Element*)ListGetHeadData(myList))->address);
+}
+
+//ListMoveToTail
+void testListMoveToTail(void)
+{
+    Element records[4] = {{0}, {1}, {2}, {3}};
+    Element a = {0};
+    Element b = {2};
+    Element c = {3};
+    List* view = ListConstructView(records, 4, sizeof(Element));
+
+    ListEnableIndex(view);
+
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToTail(view, &a));
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToTail(view, &b));
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToTail(view, &b));
+    AssertAddresses(view, (const int[]){1, 3, 0, 2}, 4);
+    TEST_ASSERT_TRUE(ListGetAt(view, 0) == &records[1]);
+    TEST_ASSERT_TRUE(ListGetAt(view, 3) == &records[2]);
+
+    TEST_ASSERT_EQUAL_INT(0, ListRemove(view, &c));
+    TEST_ASSERT_EQUAL_INT(0, ListMoveToTail(view, &a));
+    AssertAddresses(view, (const int[]){1, 2, 0}, 3);
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToTail(view, &c));
+    TEST_ASSERT_EQUAL_INT(-1, ListMoveToTail(NULL, &a));
+    ListDestruct(&view);
+}
+
+//ListToArray
+void testListToArray(void)
+{
+    size_t count = 99;
+
+    TEST_ASSERT_NULL(ListToArray(myList, &count));
+    TEST_ASSERT_EQUAL_UINT(0, count);
+
+    for (int address = 0; address < 100; address++)
+    {
+        Element a = {address};
+
+        if (address % 7 == 0)
+        {
+            ListAdoptHead(myList, NewElement(address));
+        }
+        else
+        {
+            ListAddHead(myList, &a);
+        }
+    }
+
+    Element* array = ListToArray(myList, &count);
+
+    TEST_ASSERT_EQUAL_UINT(100, count);
+
+    for (int index = 0; index < 100; index++)
+    {
+        TEST_ASSERT_EQUAL_INT(99 - index, array[index].address);
+    }
+
+    free(array);
+    TEST_ASSERT_NULL(ListToArray(NULL, &count));
+}
+
+void testListToArray_WhenSnapshotIsAlive_SkipRemovedElements(void)
+{
+    Element records[6] = {{0}, {1}, {2}, {3}, {4}, {5}};
+    Element a = {2};
+    List* view = ListConstructView(records, 6, sizeof(Element));
+    ListSnapshotHandle* snapshot = ListSnapshot(view);
+    size_t count;
+
+    ListRemove(view, &a);
+    ListRemoveTail(view);
+
+    Element* array = ListToArray(view, &count);
+    TEST_ASSERT_EQUAL_UINT(4, count);
+    TEST_ASSERT_EQUAL_INT(0, array[0].address);
+    TEST_ASSERT_EQUAL_INT(1, array[1].address);
+    TEST_ASSERT_EQUAL_INT(3, array[2].address);
+    TEST_ASSERT_EQUAL_INT(4, array[3].address);
+
+    free(array);
+    ListSnapshotRelease(&snapshot);
+    ListDestruct(&view);
+}
+
+//ListCopyInto
+void testListCopyInto(void)
+{
+    Element records[8] = {{0}, {1}, {2}, {3}, {4}, {5}, {6}, {7}};
+    Element a = {20};
+    Element b = {3};
+    Element buffer[10];
+    List* view = ListConstructView(records, 8, sizeof(Element));
+
+    ListAddAfter(view, &a, &b);
+    ListAddTail(view, &a);
+
+    TEST_ASSERT_EQUAL_UINT(5, ListCopyInto(view, buffer, 5));
+    TEST_ASSERT_EQUAL_INT(20, buffer[4].address);
+    TEST_ASSERT_EQUAL_UINT(10, ListCopyInto(view, buffer, 20));
+    TEST_ASSERT_EQUAL_INT(3, buffer[3].address);
+    TEST_ASSERT_EQUAL_INT(4, buffer[5].address);
+    TEST_ASSERT_EQUAL_INT(7, buffer[8].address);
+    TEST_ASSERT_EQUAL_INT(20, buffer[9].address);
+
+    TEST_ASSERT_EQUAL_UINT(0, ListCopyInto(view, NULL, 5));
+    TEST_ASSERT_EQUAL_UINT(0, ListCopyInto(NULL, buffer, 5));
+    ListDestruct(&view);
+}
+
+//ListCopyRangeInto
+void testListCopyRangeInto(void)
+{
+    Element buffer[4];
+
+    for (int address = 0; address < 50; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    TEST_ASSERT_EQUAL_UINT(4, ListCopyRangeInto(myList, 10, 4, buffer));
+    TEST_ASSERT_EQUAL_INT(39, buffer[0].address);
+    TEST_ASSERT_EQUAL_INT(36, buffer[3].address);
+
+    ListEnableIndex(myList);
+    TEST_ASSERT_EQUAL_UINT(2, ListCopyRangeInto(myList, 48, 4, buffer));
+    TEST_ASSERT_EQUAL_INT(1, buffer[0].address);
+    TEST_ASSERT_EQUAL_INT(0, buffer[1].address);
+
+    TEST_ASSERT_EQUAL_UINT(0, ListCopyRangeInto(myList, 50, 4, buffer));
+    TEST_ASSERT_EQUAL_UINT(0, ListCopyRangeInto(myList, 0, 0, buffer));
+    TEST_ASSERT_EQUAL_UINT(0, ListCopyRangeInto(NULL, 0, 4, buffer));
+}
+
+void testListCopyRangeInto_WhenViewIsUntouched_CopyFromArray(void)
+{
+    Element records[6] = {{0}, {1}, {2}, {3}, {4}, {5}};
+    Element buffer[4];
+    Element a = {0};
+    List* view = ListConstructView(records, 6, sizeof(Element));
+
+    TEST_ASSERT_TRUE(ListGetAt(view, 3) == &records[3]);
+    TEST_ASSERT_EQUAL_UINT(3, ListCopyRangeInto(view, 3, 4, buffer));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&records[3], buffer, 3 * sizeof(Element)));
+
+    ListMoveToTail(view, &a);
+    TEST_ASSERT_TRUE(ListGetAt(view, 3) == &records[4]);
+    TEST_ASSERT_EQUAL_UINT(3, ListCopyRangeInto(view, 3, 4, buffer));
+    TEST_ASSERT_EQUAL_INT(4, buffer[0].address);
+    TEST_ASSERT_EQUAL_INT(0, buffer[2].address);
+    ListDestruct(&view);
+}
+
+//ListGetStats
+void testListGetStats_WhenListIsNULL_Return(void)
+{
+    ListStats stats;
+    List* newList = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, ListGetStats(newList, &stats));
+}
+
+void testListGetStats_WhenStatsIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListGetStats(myList, NULL));
+}
+
+#ifdef LIST_STATS
+void testListGetStats_CountsCallsAndCompares(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+    ListStats stats;
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListRemove(myList, &c);
+
+    TEST_ASSERT_EQUAL_INT(0, ListGetStats(myList, &stats));
+    TEST_ASSERT_EQUAL_UINT(2, stats.op[LIST_OP_ADD_TAIL].calls);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADD_TAIL].allocations);
+    TEST_ASSERT_EQUAL_UINT(2 * sizeof(Element), stats.op[LIST_OP_ADD_TAIL].bytesCopied);
+    TEST_ASSERT_EQUAL_UINT(1, stats.op[LIST_OP_REMOVE].calls);
+    TEST_ASSERT_EQUAL_UINT(2, stats.op[LIST_OP_REMOVE].compareCalls);
+    TEST_ASSERT_EQUAL_UINT(2, stats.op[LIST_OP_REMOVE].nodesVisited);
+}
+
+void testListGetStats_CountsNodesVisitedPerOperation(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+    Element d = {760};
+    ListStats stats;
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListAddTail(myList, &c);
+    ListAddBefore(myList, &d, &c);
+    ListGetTailData(myList);
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(3, stats.op[LIST_OP_ADD_TAIL].nodesVisited);
+    TEST_ASSERT_EQUAL_UINT(3, stats.op[LIST_OP_ADD_BEFORE].nodesVisited);
+    TEST_ASSERT_EQUAL_UINT(3, stats.op[LIST_OP_ADD_BEFORE].compareCalls);
+    TEST_ASSERT_EQUAL_UINT(4, stats.op[LIST_OP_GET_TAIL_DATA].nodesVisited);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_REMOVE].calls);
+}
+
+void testListGetStats_CountsParallelScans(void)
+{
+    Element a = {20};
+    Element b = {240};
+    Element c = {60};
+    long sum = 0;
+    ListStats stats;
+
+    ListAddTail(myList, &a);
+    ListAddTail(myList, &b);
+    ListAddTail(myList, &c);
+    ListReduceParallel(myList, SumAddress, SumPartial, &sum, sizeof(sum), NULL, 2);
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(1, stats.op[LIST_OP_REDUCE_PARALLEL].calls);
+    TEST_ASSERT_EQUAL_UINT(3, stats.op[LIST_OP_REDUCE_PARALLEL].nodesVisited);
+}
+
+void testListGetStats_CountsAllocationsOnlyPastInlineSlots(void)
+{
+    ListStats stats;
+
+    for (int index = 0; index < 9; index++)
+    {
+        Element element = {index};
+        ListAddTail(myList, &element);
+    }
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(1, stats.op[LIST_OP_ADD_TAIL].allocations);
+
+    ListRemoveHead(myList);
+    Element element = {100};
+    ListAddHead(myList, &element);
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADD_HEAD].allocations);
+}
+
+void testListGetStats_WhenSnapshotWasTaken_AllocateNodeTracks(void)
+{
+    ListStats stats;
+    Element element = {100};
+
+    for (int index = 0; index < 9; index++)
+    {
+        element.address = index;
+        ListAddTail(myList, &element);
+    }
+
+    ListSnapshotHandle* snapshot = ListSnapshot(myList);
+    ListSnapshotRelease(&snapshot);
+    ListResetStats(myList);
+    ListAddHead(myList, &element);
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(2, stats.op[LIST_OP_ADD_HEAD].allocations);
+}
+
+void testListGetStats_WhenBufferIsAdopted_CopyNothing(void)
+{
+    ListStats stats;
+
+    ListAdoptTail(myList, NewElement(20));
+    free(ListDetachHead(myList));
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(1, stats.op[LIST_OP_ADOPT_TAIL].calls);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADOPT_TAIL].bytesCopied);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_DETACH_HEAD].bytesCopied);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_DETACH_HEAD].allocations);
+}
+
+void testListGetStats_WhenNodesAreReserved_EmplaceAllocatesNothing(void)
+{
+    ListStats stats;
+
+    ListReserve(myList, 64);
+
+    for (int round = 0; round < 2; round++)
+    {
+        for (int index = 0; index < 64; index++)
+        {
+            ((Element*)ListEmplaceTail(myList))->address = index;
+        }
+
+        ListClear(myList);
+    }
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_TRUE(stats.op[LIST_OP_RESERVE].allocations > 0);
+    TEST_ASSERT_EQUAL_UINT(128, stats.op[LIST_OP_EMPLACE_TAIL].calls);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_EMPLACE_TAIL].allocations);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_EMPLACE_TAIL].bytesCopied);
+}
+
+void testListGetStats_WhenListIsVariable_ComparesMatchingLengthsOnly(void)
+{
+    List* newList = ListConstructVariable();
+    ListStats stats;
+
+    ListAddTailVariable(newList, "ab", 2);
+    ListAddTailVariable(newList, "abc", 3);
+    ListAddTailVariable(newList, "xyz", 3);
+    ListRemoveVariable(newList, "xyz", 3);
+
+    ListGetStats(newList, &stats);
+    TEST_ASSERT_EQUAL_UINT(8, stats.op[LIST_OP_ADD_TAIL].bytesCopied);
+    TEST_ASSERT_EQUAL_UINT(1, stats.op[LIST_OP_ADD_TAIL].allocations);
+    TEST_ASSERT_EQUAL_UINT(3, stats.op[LIST_OP_REMOVE].nodesVisited);
+    TEST_ASSERT_EQUAL_UINT(2, stats.op[LIST_OP_REMOVE].compareCalls);
+
+    ListDestruct(&newList);
+}
+
+void testListGetStats_WhenFilterIsEnabled_ReportFalsePositiveRate(void)
+{
+    ListStats stats;
+
+    ListEnableFilter(myList, 1000);
+
+    for (int address = 0; address < 1000; address++)
+    {
+        Element a = {address};
+        ListAddTail(myList, &a);
+    }
+
+    for (int address = 1000; address < 11000; address++)
+    {
+        Element a = {address};
+        ListRemove(myList, &a);
+    }
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(10000, stats.filterRejections + stats.filterFalsePositives);
+    TEST_ASSERT_TRUE(stats.filterFalsePositiveRate < 0.05);
+    TEST_ASSERT_TRUE(stats.filterFalsePositiveRate ==
+                     (double)stats.filterFalsePositives / 10000.0);
+    TEST_ASSERT_EQUAL_UINT(stats.filterFalsePositives * 1000, stats.op[LIST_OP_REMOVE].nodesVisited);
+}
+
+void testListGetStats_WhenIndexIsEnabled_VisitFewNodes(void)
+{
+    ListStats stats;
+
+    for (int address = 0; address < 4096; address++)
+    {
+        Element a = {address};
+        ListAddTail(myList, &a);
+    }
+
+    ListGetAt(myList, 3000);
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(3001, stats.op[LIST_OP_GET_AT].nodesVisited);
+
+    ListEnableIndex(myList);
+    ListResetStats(myList);
+    TEST_ASSERT_EQUAL_INT(3000, ((Element*)ListGetAt(myList, 3000))->address);
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_TRUE(stats.op[LIST_OP_GET_AT].nodesVisited < 64);
+}
+
+void testListGetStats_WhenHugePagesAreEnabled_CountSlabsOnly(void)
+{
+    ListStats stats;
+
+    ListEnableHugePages(myList);
+
+    for (int address = 0; address < 10000; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADD_HEAD].allocations);
+
+    for (int address = 0; address < 100000; address++)
+    {
+        Element a = {address};
+        ListAddHead(myList, &a);
+    }
+
+    // 110000 nodes of 48 bytes fill three 2 MiB slabs; the first was mapped by ListEnableHugePages.
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_TRUE(stats.op[LIST_OP_ADD_HEAD].allocations >= 2);
+    TEST_ASSERT_TRUE(stats.op[LIST_OP_ADD_HEAD].allocations <= 3);
+}
+
+void testListGetStats_WhenViewIsExported_CountBytesCopied(void)
+{
+    Element records[16];
+    Element buffer[16];
+    ListStats stats;
+
+    for (int index = 0; index < 16; index++)
+    {
+        records[index].address = index;
+    }
+
+    List* view = ListConstructView(records, 16, sizeof(Element));
+
+    TEST_ASSERT_EQUAL_UINT(16, ListCopyInto(view, buffer, 16));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(records, buffer, sizeof(records)));
+
+    ListGetStats(view, &stats);
+    TEST_ASSERT_EQUAL_UINT(1, stats.op[LIST_OP_COPY_INTO].calls);
+    TEST_ASSERT_EQUAL_UINT(16, stats.op[LIST_OP_COPY_INTO].nodesVisited);
+    TEST_ASSERT_EQUAL_UINT(sizeof(records), stats.op[LIST_OP_COPY_INTO].bytesCopied);
+    ListDestruct(&view);
+}
+
+void testListResetStats(void)
+{
+    Element a = {20};
+    ListStats stats;
+
+    ListAddHead(myList, &a);
+    TEST_ASSERT_EQUAL_INT(0, ListResetStats(myList));
+
+    ListGetStats(myList, &stats);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADD_HEAD].calls);
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADD_HEAD].allocations);
+}
+#else
+void testListGetStats_WhenStatsAreCompiledOut_ReturnZero(void)
+{
+    Element a = {20};
+    ListStats stats;
+
+    ListAddHead(myList, &a);
+
+    TEST_ASSERT_EQUAL_INT(0, ListGetStats(myList, &stats));
+    TEST_ASSERT_EQUAL_UINT(0, stats.op[LIST_OP_ADD_HEAD].calls);
+}
+#endif
+
+void testListResetStats_WhenListIsNULL_Return(void)
+{
+    List* newList = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, ListResetStats(newList));
+}
+
+int main()
+{
+    UnityBeginParallel(0);
+
+    // ListConstruct
+    MY_RUN_TEST(testListConstruct);
+    MY_RUN_TEST(testListConstruct_WhenDataSizeIsZero_ReturnNULL);
+    MY_RUN_TEST(testListConstruct_WhenDataSizeIsLessThenZero_ReturnNULL);
+
+    //ListDestruct
+    MY_RUN_TEST(testListDestruct);
+    MY_RUN_TEST(testListDestruct_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListDestruct_WhenListIsFilled);
+    
+    //ListGetHeadData
+    MY_RUN_TEST(testListGetHeadData);
+    MY_RUN_TEST(testListGetHeadData_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListGetHeadData_WhenListIsEmpty_ReturnNULL);
+
+    //ListGetTailData
+    MY_RUN_TEST(testListGetTailData);
+    MY_RUN_TEST(testListGetTailData_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListGetTailData_WhenListIsEmpty_ReturnNULL);
+
+    //ListGetNextData
+    MY_RUN_TEST(testListGetNextData);
+    MY_RUN_TEST(testListGetNextData_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListGetNextData_WhenListIsEmpty_ReturnNULL);
+    MY_RUN_TEST(testListGetNextData_WhenFirstDataIsRequested_ReturnNULL);
+    MY_RUN_TEST(testListGetNextData_WhenDataIsAdded_NextDataIsReturned);
+    MY_RUN_TEST(testListGetNextData_WhenLastAccessedIsDeleted_ReturnNULL);
+
+    //ListGetPreviousData
+    MY_RUN_TEST(testListGetPreviousData);
+    MY_RUN_TEST(testListGetPreviousData_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListGetPreviousData_WhenListIsEmpty_ReturnNULL);
+    MY_RUN_TEST(testListGetPreviousData_WhenFirstDataIsRequested_ReturnNULL);
+    MY_RUN_TEST(testListGetPreviousData_WhenDataIsAdded_PreviousDataIsReturned);
+    MY_RUN_TEST(testListGetPreviousData_WhenLastAccessedIsDeleted_ReturnNULL);
+
+    //ListAddHead
+    MY_RUN_TEST(testListAddHead);
+    MY_RUN_TEST(testListAddHead_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListAddHead_WhenDataIsNULL_Return);
+    MY_RUN_TEST(testListAddHead_WhenListIsEmpty_AddNodeToFrontOfList);
+
+    //ListAddTail
+    MY_RUN_TEST(testListAddTail);
+    MY_RUN_TEST(testListAddTail_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListAddTail_WhenDataIsNULL_Return);
+    MY_RUN_TEST(testListAddTail_WhenListIsEmpty_AddNodeToEndOfList);
+    MY_RUN_TEST(testListAddTail_WhenInlineSlotsAreExhausted_KeepOrder);
+    MY_RUN_TEST(testListAddTail_WhenElementsAreLarge_StoreFullElement);
+
+    //ListAddBefore
+    MY_RUN_TEST(testListAddBefore);
+    MY_RUN_TEST(testListAddBefore_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListAddBefore_WhenDataIsNULL_Return);
+    MY_RUN_TEST(testListAddBefore_WhenRefDataIsNULL_Return);
+    MY_RUN_TEST(testListAddBefore_WhenRefDataIsNotFound_Return);
+    MY_RUN_TEST(testListAddBefore_WhenRefDataIsFirstNode_AddNodeToFrontOfList);
+    MY_RUN_TEST(testListAddBefore_WhenRefDataExist_AddNewNodeBetweenNodes);
+
+    //ListAddAfter
+    MY_RUN_TEST(testListAddAfter);
+    MY_RUN_TEST(testListAddAfter_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListAddAfter_WhenDataIsNULL_Return);
+    MY_RUN_TEST(testListAddAfter_WhenRefDataIsNULL_Return);
+    MY_RUN_TEST(testListAddAfter_WhenRefDataIsNotFound_Return);
+    MY_RUN_TEST(testListAddAfter_WhenRefDataIsLastNode_AddNodeToEndOfList);
+    MY_RUN_TEST(testListAddAfter_WhenRefDataExist_AddNewNodeBetweenNodes);
+
+    //ListAdoptHead
+    MY_RUN_TEST(testListAdoptHead);
+    MY_RUN_TEST(testListAdoptHead_WhenArgumentIsNULL_Return);
+
+    //ListAdoptTail
+    MY_RUN_TEST(testListAdoptTail);
+    MY_RUN_TEST(testListAdoptTail_WhenElementIsRemoved_FreeBuffer);
+    MY_RUN_TEST(testListAdoptTail_WhenListIsRcu_ReadersFindNextElement);
+
+    //ListAdoptAfter
+    MY_RUN_TEST(testListAdoptAfter);
+    MY_RUN_TEST(testListAdoptAfter_WhenRefDataIsNotFound_Return);
+
+    //ListEmplaceHead
+    MY_RUN_TEST(testListEmplaceHead);
+    MY_RUN_TEST(testListEmplaceHead_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListEmplaceHead_WhenListIsRcu_ReturnNULL);
+
+    //ListEmplaceTail
+    MY_RUN_TEST(testListEmplaceTail);
+
+    //ListEmplaceAfterCursor
+    MY_RUN_TEST(testListEmplaceAfterCursor);
+    MY_RUN_TEST(testListEmplaceAfterCursor_WhenNoElementWasAccessed_ReturnNULL);
+
+    //ListReserve
+    MY_RUN_TEST(testListReserve);
+    MY_RUN_TEST(testListReserve_WhenListIsNULL_Return);
+
+    //ListRemoveHead
+    MY_RUN_TEST(testListRemoveHead);
+    MY_RUN_TEST(testListRemoveHead_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListRemoveHead_WhenListIsEmpty_Return);
+
+    //ListDetachHead
+    MY_RUN_TEST(testListDetachHead_WhenBufferIsAdopted_ReturnSameBuffer);
+    MY_RUN_TEST(testListDetachHead_WhenElementIsCopied_ReturnNewBuffer);
+    MY_RUN_TEST(testListDetachHead_WhenSnapshotIsAlive_CopyData);
+    MY_RUN_TEST(testListDetachHead_WhenListIsEmpty_ReturnNULL);
+    
+    //ListRemoveTail
+    MY_RUN_TEST(testListRemoveTail);
+    MY_RUN_TEST(testListRemoveTail_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListRemoveTail_WhenListIsEmpty_Return);
+
+    //ListRemove
+    MY_RUN_TEST(testListRemove);
+    MY_RUN_TEST(testListRemove_WhenListIsNull_Return);
+    MY_RUN_TEST(testListRemove_WhenListIsEmpty_Return);
+    MY_RUN_TEST(testListRemove_WhenRefDataIsNull_Return);
     MY_RUN_TEST(testListRemove_WhenRefDataIsNotFound_Return);
     MY_RUN_TEST(testListRemove_WhenRefDataIsFirstNode_RemoveNode);
     MY_RUN_TEST(testListRemove_WhenRefDataIsLastNode_RemoveNode);
+    MY_RUN_TEST(testListRemove_WhenInlineSlotsAreReused_KeepOrder);
     
     //ListClear
     MY_RUN_TEST(testListClear);
     MY_RUN_TEST(testListClear_WhenListIsNull_Return);
     MY_RUN_TEST(testListClear_WhenListIsEmpty);
 
+    //ListGetLength
+    MY_RUN_TEST(testListGetLength);
+    MY_RUN_TEST(testListGetLength_WhenListIsNULL_ReturnZero);
+
+    //ListForEachParallel
+    MY_RUN_TEST(testListForEachParallel);
+    MY_RUN_TEST(testListForEachParallel_WhenListChanges_VisitsNewContent);
+    MY_RUN_TEST(testListForEachParallel_WhenListIsEmpty_VisitNothing);
+    MY_RUN_TEST(testListForEachParallel_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListForEachParallel_WhenVisitIsNULL_Return);
+
+    //ListReduceParallel
+    MY_RUN_TEST(testListReduceParallel);
+    MY_RUN_TEST(testListReduceParallel_CombinesPartialsInListOrder);
+    MY_RUN_TEST(testListReduceParallel_WhenListIsEmpty_KeepIdentity);
+    MY_RUN_TEST(testListReduceParallel_WhenArgumentIsNULL_Return);
+
+    //ListSnapshot
+    MY_RUN_TEST(testListSnapshot);
+    MY_RUN_TEST(testListSnapshot_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListSnapshot_WhenListIsCleared_KeepsTailAndPrevious);
+    MY_RUN_TEST(testListSnapshot_WhenReleased_ListKeepsWorking);
+    MY_RUN_TEST(testListSnapshot_WhenListIsDestructed_SnapshotStaysReadable);
+    MY_RUN_TEST(testListSnapshot_WhenParallelScanRuns_SkipRemovedElements);
+    MY_RUN_TEST(testListSnapshot_WhenWriterRunsConcurrently_ViewStaysConsistent);
+
+    //ListSnapshotRelease
+    MY_RUN_TEST(testListSnapshotRelease_WhenSnapshotIsNULL_Return);
+
+    //ListEnableRcu
+    MY_RUN_TEST(testListEnableRcu);
+    MY_RUN_TEST(testListEnableRcu_WhenListIsNotEmpty_Return);
+    MY_RUN_TEST(testListEnableRcu_WhenDomainIsNULL_UseDefaultDomain);
+    MY_RUN_TEST(testListRcuGetHeadData_WhenListIsNULL_ReturnNULL);
+    MY_RUN_TEST(testListRcu_WhenWriterRunsConcurrently_ReadersSeeOrderedElements);
+
+    //ListConstructVariable
+    MY_RUN_TEST(testListConstructVariable);
+
+    //ListAddTailVariable
+    MY_RUN_TEST(testListAddTailVariable);
+    MY_RUN_TEST(testListAddTailVariable_WhenElementsSpanSlabs_KeepData);
+    MY_RUN_TEST(testListAddTailVariable_WhenListHasFixedSize_Return);
+    MY_RUN_TEST(testListAddTailVariable_WhenDataHasFixedSize_Return);
+
+    //ListRemoveVariable
+    MY_RUN_TEST(testListRemoveVariable);
+    MY_RUN_TEST(testListRemoveVariable_WhenSnapshotIsAlive_SnapshotKeepsData);
+
+    //ListGetDataLength
+    MY_RUN_TEST(testListGetDataLength_WhenListHasFixedSize_ReturnDataSize);
+
+    //ListEnableFilter
+    MY_RUN_TEST(testListEnableFilter);
+    MY_RUN_SERIAL_TEST(testListEnableFilter_WhenSearchesMiss_StayWithinTimeBudget);
+    MY_RUN_TEST(testListEnableFilter_WhenListIsNotEmpty_CountExistingElements);
+    MY_RUN_TEST(testListEnableFilter_WhenListIsCleared_ForgetElements);
+    MY_RUN_TEST(testListEnableFilter_WhenListIsVariable_FilterLengthAndBytes);
+    MY_RUN_TEST(testListEnableFilter_WhenArgumentIsNULL_Return);
+
+    //ListEnableIndex
+    MY_RUN_TEST(testListEnableIndex);
+    MY_RUN_TEST(testListEnableIndex_WhenListChanges_MatchReferenceArray);
+    MY_RUN_TEST(testListEnableIndex_WhenSnapshotIsAlive_IndexLiveElementsOnly);
+
+    //ListGetAt
+    MY_RUN_TEST(testListGetAt_WhenIndexIsDisabled_WalkAndMoveCursor);
+    MY_RUN_SERIAL_TEST(testListGetAt_WhenIndexIsEnabled_StayWithinTimeBudget);
+
+    //ListInsertAt
+    MY_RUN_TEST(testListInsertAt);
+    MY_RUN_TEST(testListInsertAt_WhenArgumentIsInvalid_Return);
+
+    //ListRemoveAt
+    MY_RUN_TEST(testListRemoveAt);
+
+    //ListAddTailH
+    MY_RUN_TEST(testListAddTailH);
+    MY_RUN_TEST(testListAddTailH_WhenArgumentIsInvalid_ReturnNULLHandle);
+
+    //ListInsertAfterHandle
+    MY_RUN_TEST(testListInsertAfterHandle);
+
+    //ListRemoveHandle
+    MY_RUN_TEST(testListRemoveHandle);
+    MY_RUN_TEST(testListRemoveHandle_WhenNodeIsReused_DetectStaleHandle);
+    MY_RUN_TEST(testListRemoveHandle_WhenSnapshotIsAlive_HandleIsStaleAtOnce);
+
+    //ListClearAsync
+    MY_RUN_TEST(testListClearAsync);
+    MY_RUN_TEST(testListClearAsync_WhenSnapshotIsAlive_ClearSynchronously);
+
+    //ListDestructAsync
+    MY_RUN_TEST(testListDestructAsync);
+    MY_RUN_TEST(testListDestructAsync_WhenArgumentIsNULL_Return);
+
+    //ListReclaimerConfigure
+    MY_RUN_TEST(testListReclaimerConfigure);
+
+    //ListEnableHugePages
+    MY_RUN_TEST(testListEnableHugePages);
+    MY_RUN_TEST(testListEnableHugePages_WhenListIsVariable_KeepPayloadsInArena);
+    MY_RUN_TEST(testListEnableHugePages_WhenModeIsIncompatible_Return);
+
+    //ListConstructView
+    MY_RUN_TEST(testListConstructView);
+    MY_RUN_TEST(testListConstructView_WhenSnapshotIsAlive_KeepRemovedElements);
+    MY_RUN_TEST(testListConstructView_WhenArgumentIsInvalid_ReturnNULL);
+
+    //ListMoveToHead
+    MY_RUN_TEST(testListMoveToHead);
+    MY_RUN_TEST(testListMoveToHead_WhenSnapshotIsAlive_Return);
+
+    //ListMoveToTail
+    MY_RUN_TEST(testListMoveToTail);
+
+    //ListToArray
+    MY_RUN_TEST(testListToArray);
+    MY_RUN_TEST(testListToArray_WhenSnapshotIsAlive_SkipRemovedElements);
+
+    //ListCopyInto
+    MY_RUN_TEST(testListCopyInto);
+
+    //ListCopyRangeInto
+    MY_RUN_TEST(testListCopyRangeInto);
+    MY_RUN_TEST(testListCopyRangeInto_WhenViewIsUntouched_CopyFromArray);
+
+    //ListGetStats
+    MY_RUN_TEST(testListGetStats_WhenListIsNULL_Return);
+    MY_RUN_TEST(testListGetStats_WhenStatsIsNULL_Return);
+#ifdef LIST_STATS
+    MY_RUN_TEST(testListGetStats_CountsCallsAndCompares);
+    MY_RUN_TEST(testListGetStats_CountsNodesVisitedPerOperation);
+    MY_RUN_TEST(testListGetStats_CountsParallelScans);
+    MY_RUN_TEST(testListGetStats_CountsAllocationsOnlyPastInlineSlots);
+    MY_RUN_TEST(testListGetStats_WhenSnapshotWasTaken_AllocateNodeTracks);
+    MY_RUN_TEST(testListGetStats_WhenBufferIsAdopted_CopyNothing);
+    MY_RUN_TEST(testListGetStats_WhenNodesAreReserved_EmplaceAllocatesNothing);
+    MY_RUN_TEST(testListGetStats_WhenListIsVariable_ComparesMatchingLengthsOnly);
+    MY_RUN_TEST(testListGetStats_WhenFilterIsEnabled_ReportFalsePositiveRate);
+    MY_RUN_TEST(testListGetStats_WhenIndexIsEnabled_VisitFewNodes);
+    MY_RUN_TEST(testListGetStats_WhenHugePagesAreEnabled_CountSlabsOnly);
+    MY_RUN_TEST(testListGetStats_WhenViewIsExported_CountBytesCopied);
+    MY_RUN_TEST(testListResetStats);
+#else
+    MY_RUN_TEST(testListGetStats_WhenStatsAreCompiledOut_ReturnZero);
+#endif
+    MY_RUN_TEST(testListResetStats_WhenListIsNULL_Return);
+
     return UnityEnd();
 }
@@ -0,0 +1,217 @@
+#include "unity.h"
+#include "linked_list.h"
+#include "list_latency.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static List* myList = NULL;
+
+void setUp(void)
+{
+    myList = ListConstruct(sizeof(int));
+    ListLatencyReset();
+    ListLatencySetSampleInterval(1);
+}
+
+void tearDown(void)
+{
+    ListDestruct(&myList);
+    ListLatencySetSampleInterval(LIST_LATENCY_DEFAULT_SAMPLE_INTERVAL);
+}
+
+//ListLatencySetSampleInterval
+void testListLatencySetSampleInterval(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, ListLatencySetSampleInterval(16));
+    TEST_ASSERT_EQUAL_UINT(16, ListLatencyGetSampleInterval());
+}
+
+void testListLatencySetSampleInterval_WhenIntervalIsZero_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListLatencySetSampleInterval(0));
+    TEST_ASSERT_EQUAL_UINT(1, ListLatencyGetSampleInterval());
+}
+
+//ListLatencyGetSummary
+void testListLatencyGetSummary_WhenNothingRecorded_ReturnZero(void)
+{
+    ListLatencySummary summary;
+
+    TEST_ASSERT_EQUAL_INT(0, ListLatencyGetSummary(LIST_OP_ADD_TAIL, &summary));
+    TEST_ASSERT_EQUAL_UINT(0, summary.samples);
+    TEST_ASSERT_EQUAL_UINT(0, summary.max);
+}
+
+void testListLatencyGetSummary_WhenArgumentsAreInvalid_Return(void)
+{
+    ListLatencySummary summary;
+
+    TEST_ASSERT_EQUAL_INT(-1, ListLatencyGetSummary(LIST_OP_COUNT, &summary));
+    TEST_ASSERT_EQUAL_INT(-1, ListLatencyGetSummary(LIST_OP_ADD_TAIL, NULL));
+}
+
+void testListLatencyGetSummary_ReportsPercentiles(void)
+{
+    ListLatencySummary summary;
+
+    for (int i = 1; i <= 1000; i++)
+    {
+        ListLatencyRecord(LIST_OP_REMOVE_TAIL, (unsigned long long)i);
+    }
+
+    ListLatencyGetSummary(LIST_OP_REMOVE_TAIL, &summary);
+    TEST_ASSERT_EQUAL_UINT(1000, summary.samples);
+    TEST_ASSERT_UINT_WITHIN(32, 500, summary.p50);
+    TEST_ASSERT_UINT_WITHIN(64, 990, summary.p99);
+    TEST_ASSERT_UINT_WITHIN(64, 999, summary.p999);
+    TEST_ASSERT_EQUAL_UINT(1000, summary.max);
+}
+
+void testListLatencyGetSummary_SmallValuesAreExact(void)
+{
+    ListLatencySummary summary;
+
+    ListLatencyRecord(LIST_OP_ADD_HEAD, 7);
+    ListLatencyRecord(LIST_OP_ADD_HEAD, 7);
+    ListLatencyRecord(LIST_OP_ADD_HEAD, 9);
+
+    ListLatencyGetSummary(LIST_OP_ADD_HEAD, &summary);
+    TEST_ASSERT_EQUAL_UINT(7, summary.p50);
+    TEST_ASSERT_EQUAL_UINT(9, summary.p99);
+    TEST_ASSERT_EQUAL_UINT(9, summary.max);
+}
+
+//Instrumentation
+void testListLatency_InstrumentedCallsAreSampled(void)
+{
+    ListLatencySummary summary;
+    int a = 20;
+
+    for (int i = 0; i < 10; i++)
+    {
+        ListAddTail(myList, &a);
+    }
+    ListRemoveTail(myList);
+
+    ListLatencyGetSummary(LIST_OP_ADD_TAIL, &summary);
+    TEST_ASSERT_EQUAL_UINT(10, summary.samples);
+
+    ListLatencyGetSummary(LIST_OP_REMOVE_TAIL, &summary);
+    TEST_ASSERT_EQUAL_UINT(1, summary.samples);
+}
+
+void testListLatency_OnlyEveryIntervalCallIsSampled(void)
+{
+    ListLatencySummary summary;
+    int a = 20;
+
+    ListLatencySetSampleInterval(4);
+
+    for (int i = 0; i < 8; i++)
+    {
+        ListAddHead(myList, &a);
+    }
+
+    ListLatencyGetSummary(LIST_OP_ADD_HEAD, &summary);
+    TEST_ASSERT_EQUAL_UINT(2, summary.samples);
+}
+
+void testListLatency_WhenOperationsInterleave_SampleEachOperation(void)
+{
+    ListLatencySummary summary;
+    int a = 20;
+
+    ListLatencySetSampleInterval(4);
+
+    for (int i = 0; i < 64; i++)
+    {
+        ListAddTail(myList, &a);
+        ListRemoveHead(myList);
+    }
+
+    ListLatencyGetSummary(LIST_OP_ADD_TAIL, &summary);
+    TEST_ASSERT_EQUAL_UINT(16, summary.samples);
+
+    ListLatencyGetSummary(LIST_OP_REMOVE_HEAD, &summary);
+    TEST_ASSERT_EQUAL_UINT(16, summary.samples);
+}
+
+//ListLatencyDump
+void testListLatencyDump_WhenStreamIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, ListLatencyDump(NULL, LIST_LATENCY_TEXT));
+}
+
+void testListLatencyDump_Json(void)
+{
+    char buffer[512] = {0};
+    FILE* stream = tmpfile();
+
+    ListLatencyRecord(LIST_OP_REMOVE, 100);
+
+    TEST_ASSERT_EQUAL_INT(0, ListLatencyDump(stream, LIST_LATENCY_JSON));
+    rewind(stream);
+    TEST_ASSERT_NOT_NULL(fgets(buffer, sizeof(buffer), stream));
+    fclose(stream);
+
+    TEST_ASSERT_EQUAL_STRING("{\"sampleInterval\":1,\"operations\":[{\"name\":\"ListRemove\","
+                             "\"samples\":1,\"p50\":100,\"p99\":100,\"p999\":100,\"max\":100}]}\n", buffer);
+}
+
+void testListLatencyDump_Text(void)
+{
+    char buffer[512] = {0};
+    FILE* stream = tmpfile();
+
+    ListLatencyRecord(LIST_OP_ADD_BEFORE, 100);
+
+    TEST_ASSERT_EQUAL_INT(0, ListLatencyDump(stream, LIST_LATENCY_TEXT));
+    rewind(stream);
+    TEST_ASSERT_NOT_NULL(fgets(buffer, sizeof(buffer), stream));
+    TEST_ASSERT_NOT_NULL(fgets(buffer, sizeof(buffer), stream));
+    fclose(stream);
+
+    TEST_ASSERT_EQUAL_MEMORY("ListAddBefore", buffer, 13);
+}
+
+//ListLatencyOperationName
+void testListLatencyOperationName_EveryOperationIsNamed(void)
+{
+    for (int operation = 0; operation < LIST_OP_COUNT; operation++)
+    {
+        TEST_ASSERT_NOT_NULL(ListLatencyOperationName((ListOperation)operation));
+    }
+
+    TEST_ASSERT_EQUAL_STRING("ListReduceParallel", ListLatencyOperationName(LIST_OP_REDUCE_PARALLEL));
+    TEST_ASSERT_NULL(ListLatencyOperationName(LIST_OP_COUNT));
+}
+
+int main()
+{
+    UnityBegin();
+
+    //ListLatencySetSampleInterval
+    MY_RUN_TEST(testListLatencySetSampleInterval);
+    MY_RUN_TEST(testListLatencySetSampleInterval_WhenIntervalIsZero_Return);
+
+    //ListLatencyGetSummary
+    MY_RUN_TEST(testListLatencyGetSummary_WhenNothingRecorded_ReturnZero);
+    MY_RUN_TEST(testListLatencyGetSummary_WhenArgumentsAreInvalid_Return);
+    MY_RUN_TEST(testListLatencyGetSummary_ReportsPercentiles);
+    MY_RUN_TEST(testListLatencyGetSummary_SmallValuesAreExact);
+
+    //Instrumentation
+    MY_RUN_TEST(testListLatency_InstrumentedCallsAreSampled);
+    MY_RUN_TEST(testListLatency_OnlyEveryIntervalCallIsSampled);
+    MY_RUN_TEST(testListLatency_WhenOperationsInterleave_SampleEachOperation);
+
+    //ListLatencyDump
+    MY_RUN_TEST(testListLatencyDump_WhenStreamIsNULL_Return);
+    MY_RUN_TEST(testListLatencyDump_Json);
+    MY_RUN_TEST(testListLatencyDump_Text);
+
+    //ListLatencyOperationName
+    MY_RUN_TEST(testListLatencyOperationName_EveryOperationIsNamed);
+
+    return UnityEnd();
+}
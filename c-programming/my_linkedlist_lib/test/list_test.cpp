@@ -0,0 +1,244 @@
+extern "C"
+{
+#include "unity.h"
+}
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "list.hpp"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+using utilities::List;
+
+static int liveAllocations = 0;
+
+template <typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        liveAllocations++;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept
+    {
+        liveAllocations--;
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>&) const noexcept { return false; }
+};
+
+struct Tracked
+{
+    static int copies;
+    static int moves;
+
+    explicit Tracked(int value) : value(value) {}
+    Tracked(const Tracked& other) : value(other.value) { copies++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { moves++; }
+
+    int value;
+};
+
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+extern "C" void setUp(void)
+{
+    Tracked::copies = 0;
+    Tracked::moves = 0;
+}
+
+extern "C" void tearDown(void)
+{
+}
+
+//emplace_back / emplace_front
+void testListEmplace_ConstructsInPlace(void)
+{
+    List<Tracked> list;
+
+    list.emplace_back(20);
+    list.emplace_front(240);
+
+    TEST_ASSERT_EQUAL_INT(2, list.size());
+    TEST_ASSERT_EQUAL_INT(240, list.front().value);
+    TEST_ASSERT_EQUAL_INT(20, list.back().value);
+    TEST_ASSERT_EQUAL_INT(0, Tracked::copies);
+    TEST_ASSERT_EQUAL_INT(0, Tracked::moves);
+}
+
+void testListEmplace_ReturnsReferenceToNewElement(void)
+{
+    List<std::string> list;
+
+    std::string& value = list.emplace_back(3, 'x');
+    value += "y";
+
+    TEST_ASSERT_EQUAL_STRING("xxxy", list.front().c_str());
+}
+
+//Move-only elements
+void testList_SupportsMoveOnlyElements(void)
+{
+    List<std::unique_ptr<int>> list;
+
+    list.push_back(std::make_unique<int>(20));
+    list.emplace_back(new int(240));
+
+    List<std::unique_ptr<int>> moved(std::move(list));
+
+    TEST_ASSERT_TRUE(list.empty());
+    TEST_ASSERT_EQUAL_INT(2, moved.size());
+    TEST_ASSERT_EQUAL_INT(20, *moved.front());
+    TEST_ASSERT_EQUAL_INT(240, *moved.back());
+
+    std::unique_ptr<int> taken = std::move(moved.front());
+    moved.pop_front();
+    TEST_ASSERT_EQUAL_INT(20, *taken);
+    TEST_ASSERT_EQUAL_INT(1, moved.size());
+}
+
+//Iterators
+void testListIterator_TraversesBothDirections(void)
+{
+    List<int> list = {1, 2, 3};
+    std::vector<int> forward(list.begin(), list.end());
+    std::vector<int> backward(list.rbegin(), list.rend());
+
+    TEST_ASSERT_EQUAL_INT(3, forward.size());
+    TEST_ASSERT_EQUAL_INT(1, forward[0]);
+    TEST_ASSERT_EQUAL_INT(3, forward[2]);
+    TEST_ASSERT_EQUAL_INT(3, backward[0]);
+    TEST_ASSERT_EQUAL_INT(1, backward[2]);
+
+    List<int>::const_iterator position = list.end();
+    --position;
+    TEST_ASSERT_EQUAL_INT(3, *position);
+}
+
+void testListInsertAndErase(void)
+{
+    List<int> list = {20, 240};
+
+    List<int>::iterator position = list.begin();
+    ++position;
+    position = list.insert(position, 60);
+    TEST_ASSERT_EQUAL_INT(60, *position);
+
+    position = list.erase(list.begin());
+    TEST_ASSERT_EQUAL_INT(60, *position);
+    TEST_ASSERT_EQUAL_INT(2, list.size());
+    TEST_ASSERT_EQUAL_INT(240, list.back());
+}
+
+void testListRemove_RemovesAllMatches(void)
+{
+    List<int> list = {20, 240, 20, 60};
+
+    TEST_ASSERT_EQUAL_INT(2, list.remove(20));
+    TEST_ASSERT_EQUAL_INT(0, list.remove(999));
+    TEST_ASSERT_TRUE(list == (List<int>{240, 60}));
+}
+
+void testListRemove_WhenValueIsAnElement_RemovesAllMatches(void)
+{
+    List<std::string> list = {"a", "b", "a", "c", "a"};
+
+    TEST_ASSERT_EQUAL_INT(3, list.remove(list.front()));
+    TEST_ASSERT_TRUE(list == (List<std::string>{"b", "c"}));
+}
+
+void testListPopBack(void)
+{
+    List<int> list = {20, 240};
+
+    list.pop_back();
+    TEST_ASSERT_EQUAL_INT(20, list.back());
+    list.pop_back();
+    TEST_ASSERT_TRUE(list.empty());
+    TEST_ASSERT_TRUE(list.begin() == list.end());
+}
+
+//Copy, move and swap
+void testListCopyAndAssign(void)
+{
+    List<std::string> list = {"a", "b"};
+    List<std::string> copy(list);
+    List<std::string> assigned;
+
+    assigned = copy;
+    copy.push_back("c");
+
+    TEST_ASSERT_TRUE(assigned == list);
+    TEST_ASSERT_TRUE(copy != list);
+
+    assigned = std::move(copy);
+    TEST_ASSERT_EQUAL_INT(3, assigned.size());
+    TEST_ASSERT_TRUE(copy.empty());
+}
+
+void testListSwap(void)
+{
+    List<int> a = {1, 2};
+    List<int> b;
+
+    swap(a, b);
+    TEST_ASSERT_TRUE(a.empty());
+    TEST_ASSERT_EQUAL_INT(2, b.size());
+    TEST_ASSERT_EQUAL_INT(1, *b.begin());
+    TEST_ASSERT_EQUAL_INT(2, *--b.end());
+}
+
+//Allocator
+void testList_UsesAllocatorForNodes(void)
+{
+    {
+        List<std::string, CountingAllocator<std::string>> list;
+
+        list.emplace_back("a");
+        list.emplace_back("b");
+        TEST_ASSERT_EQUAL_INT(2, liveAllocations);
+
+        list.pop_front();
+        TEST_ASSERT_EQUAL_INT(1, liveAllocations);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, liveAllocations);
+}
+
+int main()
+{
+    UnityBegin();
+
+    MY_RUN_TEST(testListEmplace_ConstructsInPlace);
+    MY_RUN_TEST(testListEmplace_ReturnsReferenceToNewElement);
+    MY_RUN_TEST(testList_SupportsMoveOnlyElements);
+    MY_RUN_TEST(testListIterator_TraversesBothDirections);
+    MY_RUN_TEST(testListInsertAndErase);
+    MY_RUN_TEST(testListRemove_RemovesAllMatches);
+    MY_RUN_TEST(testListRemove_WhenValueIsAnElement_RemovesAllMatches);
+    MY_RUN_TEST(testListPopBack);
+    MY_RUN_TEST(testListCopyAndAssign);
+    MY_RUN_TEST(testListSwap);
+    MY_RUN_TEST(testList_UsesAllocatorForNodes);
+
+    return UnityEnd();
+}
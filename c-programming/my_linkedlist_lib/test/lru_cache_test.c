@@ -0,0 +1,301 @@
+#include "unity.h"
+#include "lru_cache.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static LruCache* myCache = NULL;
+
+typedef struct eviction_log EvictionLog;
+struct eviction_log
+{
+    int count;
+    int lastKey;
+    int lastValue;
+};
+
+static EvictionLog evictions;
+
+static void RecordEviction(const void* key, void* value, void* context)
+{
+    EvictionLog* log = context;
+    log->count++;
+    log->lastKey = *(const int*)key;
+    log->lastValue = *(int*)value;
+}
+
+void setUp(void)
+{
+    evictions.count = 0;
+    myCache = LruCacheConstruct(sizeof(int), sizeof(int), 3, RecordEviction, &evictions);
+}
+
+void tearDown(void)
+{
+    LruCacheDestruct(&myCache);
+}
+
+static void PutInt(int key, int value)
+{
+    LruCachePut(myCache, &key, &value);
+}
+
+// LruCacheConstruct
+void testLruCacheConstruct(void)
+{
+    LruCache* newCache = LruCacheConstruct(sizeof(int), sizeof(double), 10, NULL, NULL);
+    TEST_ASSERT_NOT_NULL(newCache);
+    TEST_ASSERT_EQUAL_UINT(10, LruCacheGetCapacity(newCache));
+    TEST_ASSERT_EQUAL_UINT(0, LruCacheGetSize(newCache));
+
+    TEST_ASSERT_EQUAL_INT(0, LruCacheDestruct(&newCache));
+    TEST_ASSERT_NULL(newCache);
+}
+
+void testLruCacheConstruct_WhenSizesAreInvalid_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(LruCacheConstruct(0, sizeof(int), 10, NULL, NULL));
+    TEST_ASSERT_NULL(LruCacheConstruct(sizeof(int), -1, 10, NULL, NULL));
+    TEST_ASSERT_NULL(LruCacheConstruct(sizeof(int), sizeof(int), 0, NULL, NULL));
+}
+
+//LruCacheDestruct
+void testLruCacheDestruct_WhenCacheIsNULL_Return(void)
+{
+    LruCache* newCache = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheDestruct(&newCache));
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheDestruct(NULL));
+}
+
+//LruCachePut
+void testLruCachePut(void)
+{
+    int key = 7;
+    int value = 700;
+
+    TEST_ASSERT_EQUAL_INT(0, LruCachePut(myCache, &key, &value));
+    TEST_ASSERT_EQUAL_UINT(1, LruCacheGetSize(myCache));
+
+    int* cached = LruCacheGet(myCache, &key);
+    TEST_ASSERT_NOT_NULL(cached);
+    TEST_ASSERT_EQUAL_INT(700, *cached);
+}
+
+void testLruCachePut_WhenKeyExists_ReplaceValue(void)
+{
+    int key = 7;
+    PutInt(7, 700);
+    PutInt(7, 701);
+
+    TEST_ASSERT_EQUAL_UINT(1, LruCacheGetSize(myCache));
+    TEST_ASSERT_EQUAL_INT(701, *(int*)LruCacheGet(myCache, &key));
+}
+
+void testLruCachePut_WhenCacheIsFull_EvictLeastRecentlyUsed(void)
+{
+    int key = 1;
+
+    PutInt(1, 100);
+    PutInt(2, 200);
+    PutInt(3, 300);
+    LruCacheGet(myCache, &key);
+    PutInt(4, 400);
+
+    TEST_ASSERT_EQUAL_UINT(3, LruCacheGetSize(myCache));
+    TEST_ASSERT_EQUAL_INT(1, evictions.count);
+    TEST_ASSERT_EQUAL_INT(2, evictions.lastKey);
+    TEST_ASSERT_EQUAL_INT(200, evictions.lastValue);
+
+    key = 2;
+    TEST_ASSERT_NULL(LruCacheGet(myCache, &key));
+}
+
+void testLruCachePut_WhenArgumentIsNULL_Return(void)
+{
+    int key = 1;
+    int value = 100;
+    TEST_ASSERT_EQUAL_INT(-1, LruCachePut(NULL, &key, &value));
+    TEST_ASSERT_EQUAL_INT(-1, LruCachePut(myCache, NULL, &value));
+    TEST_ASSERT_EQUAL_INT(-1, LruCachePut(myCache, &key, NULL));
+}
+
+void testLruCachePut_WhenValueSizeIsZero_ActsAsSet(void)
+{
+    LruCache* set = LruCacheConstruct(sizeof(int), 0, 2, NULL, NULL);
+    int key = 5;
+
+    TEST_ASSERT_EQUAL_INT(0, LruCachePut(set, &key, NULL));
+    TEST_ASSERT_EQUAL_INT(0, LruCacheTouch(set, &key));
+
+    LruCacheDestruct(&set);
+}
+
+//LruCacheGet
+void testLruCacheGet_WhenKeyIsMissing_ReturnNULL(void)
+{
+    int key = 9;
+    PutInt(1, 100);
+    TEST_ASSERT_NULL(LruCacheGet(myCache, &key));
+    TEST_ASSERT_NULL(LruCacheGet(NULL, &key));
+    TEST_ASSERT_NULL(LruCacheGet(myCache, NULL));
+}
+
+void testLruCacheGet_WithManyCollidingBuckets_FindsEveryKey(void)
+{
+    LruCache* bigCache = LruCacheConstruct(sizeof(int), sizeof(int), 1000, NULL, NULL);
+
+    for (int key = 0; key < 1000; key++)
+    {
+        int value = key * 3;
+        LruCachePut(bigCache, &key, &value);
+    }
+
+    for (int key = 0; key < 1000; key++)
+    {
+        int* value = LruCacheGet(bigCache, &key);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_INT(key * 3, *value);
+    }
+
+    LruCacheDestruct(&bigCache);
+}
+
+//LruCachePeek
+void testLruCachePeek_DoesNotChangeRecency(void)
+{
+    int key = 1;
+
+    PutInt(1, 100);
+    PutInt(2, 200);
+    PutInt(3, 300);
+    TEST_ASSERT_EQUAL_INT(100, *(int*)LruCachePeek(myCache, &key));
+    PutInt(4, 400);
+
+    TEST_ASSERT_EQUAL_INT(1, evictions.lastKey);
+    TEST_ASSERT_NULL(LruCachePeek(myCache, &key));
+}
+
+//LruCacheTouch
+void testLruCacheTouch(void)
+{
+    int key = 1;
+
+    PutInt(1, 100);
+    PutInt(2, 200);
+    PutInt(3, 300);
+    TEST_ASSERT_EQUAL_INT(0, LruCacheTouch(myCache, &key));
+    PutInt(4, 400);
+
+    TEST_ASSERT_EQUAL_INT(2, evictions.lastKey);
+}
+
+void testLruCacheTouch_WhenKeyIsMissing_Return(void)
+{
+    int key = 1;
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheTouch(myCache, &key));
+}
+
+//LruCacheEvict
+void testLruCacheEvict(void)
+{
+    PutInt(1, 100);
+    PutInt(2, 200);
+
+    TEST_ASSERT_EQUAL_INT(0, LruCacheEvict(myCache));
+    TEST_ASSERT_EQUAL_INT(1, evictions.lastKey);
+    TEST_ASSERT_EQUAL_INT(0, LruCacheEvict(myCache));
+    TEST_ASSERT_EQUAL_INT(2, evictions.lastKey);
+    TEST_ASSERT_EQUAL_UINT(0, LruCacheGetSize(myCache));
+}
+
+void testLruCacheEvict_WhenCacheIsEmpty_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheEvict(myCache));
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheEvict(NULL));
+}
+
+//LruCacheRemove
+void testLruCacheRemove(void)
+{
+    int key = 2;
+
+    PutInt(1, 100);
+    PutInt(2, 200);
+    PutInt(3, 300);
+
+    TEST_ASSERT_EQUAL_INT(0, LruCacheRemove(myCache, &key));
+    TEST_ASSERT_EQUAL_UINT(2, LruCacheGetSize(myCache));
+    TEST_ASSERT_NULL(LruCacheGet(myCache, &key));
+    TEST_ASSERT_EQUAL_INT(0, evictions.count);
+
+    PutInt(4, 400);
+    TEST_ASSERT_EQUAL_INT(0, evictions.count);
+}
+
+void testLruCacheRemove_WhenKeyIsMissing_Return(void)
+{
+    int key = 2;
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheRemove(myCache, &key));
+    TEST_ASSERT_EQUAL_INT(-1, LruCacheRemove(NULL, &key));
+}
+
+//LruCacheClear
+void testLruCacheClear(void)
+{
+    int key = 1;
+
+    PutInt(1, 100);
+    PutInt(2, 200);
+
+    TEST_ASSERT_EQUAL_INT(0, LruCacheClear(myCache));
+    TEST_ASSERT_EQUAL_UINT(0, LruCacheGetSize(myCache));
+    TEST_ASSERT_NULL(LruCacheGet(myCache, &key));
+    TEST_ASSERT_EQUAL_INT(0, evictions.count);
+
+    PutInt(1, 100);
+    PutInt(2, 200);
+    PutInt(3, 300);
+    TEST_ASSERT_EQUAL_UINT(3, LruCacheGetSize(myCache));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // LruCacheConstruct
+    MY_RUN_TEST(testLruCacheConstruct);
+    MY_RUN_TEST(testLruCacheConstruct_WhenSizesAreInvalid_ReturnNULL);
+
+    //LruCacheDestruct
+    MY_RUN_TEST(testLruCacheDestruct_WhenCacheIsNULL_Return);
+
+    //LruCachePut
+    MY_RUN_TEST(testLruCachePut);
+    MY_RUN_TEST(testLruCachePut_WhenKeyExists_ReplaceValue);
+    MY_RUN_TEST(testLruCachePut_WhenCacheIsFull_EvictLeastRecentlyUsed);
+    MY_RUN_TEST(testLruCachePut_WhenArgumentIsNULL_Return);
+    MY_RUN_TEST(testLruCachePut_WhenValueSizeIsZero_ActsAsSet);
+
+    //LruCacheGet
+    MY_RUN_TEST(testLruCacheGet_WhenKeyIsMissing_ReturnNULL);
+    MY_RUN_TEST(testLruCacheGet_WithManyCollidingBuckets_FindsEveryKey);
+
+    //LruCachePeek
+    MY_RUN_TEST(testLruCachePeek_DoesNotChangeRecency);
+
+    //LruCacheTouch
+    MY_RUN_TEST(testLruCacheTouch);
+    MY_RUN_TEST(testLruCacheTouch_WhenKeyIsMissing_Return);
+
+    //LruCacheEvict
+    MY_RUN_TEST(testLruCacheEvict);
+    MY_RUN_TEST(testLruCacheEvict_WhenCacheIsEmpty_Return);
+
+    //LruCacheRemove
+    MY_RUN_TEST(testLruCacheRemove);
+    MY_RUN_TEST(testLruCacheRemove_WhenKeyIsMissing_Return);
+
+    //LruCacheClear
+    MY_RUN_TEST(testLruCacheClear);
+
+    return UnityEnd();
+}
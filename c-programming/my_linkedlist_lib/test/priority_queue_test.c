@@ -0,0 +1,263 @@
+#include <stdint.h>
+#include "unity.h"
+#include "priority_queue.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static PriorityQueue* myQueue = NULL;
+
+typedef struct job Job;
+struct job
+{
+    int priority;
+    int id;
+};
+
+static int CompareJobs(const void* a, const void* b, void* context)
+{
+    (void)context;
+    const Job* left = a;
+    const Job* right = b;
+
+    return (left->priority > right->priority) - (left->priority < right->priority);
+}
+
+void setUp(void)
+{
+    myQueue = PriorityQueueConstruct(sizeof(Job), 0, CompareJobs, NULL);
+}
+
+void tearDown(void)
+{
+    PriorityQueueDestruct(&myQueue);
+}
+
+static void PushJob(int priority, int id)
+{
+    Job job = {priority, id};
+    PriorityQueuePush(myQueue, &job, NULL);
+}
+
+// PriorityQueueConstruct
+void testPriorityQueueConstruct(void)
+{
+    PriorityQueue* newQueue = PriorityQueueConstruct(sizeof(Job), 2, CompareJobs, NULL);
+    TEST_ASSERT_NOT_NULL(newQueue);
+    TEST_ASSERT_EQUAL_UINT(0, PriorityQueueGetSize(newQueue));
+
+    TEST_ASSERT_EQUAL_INT(0, PriorityQueueDestruct(&newQueue));
+    TEST_ASSERT_NULL(newQueue);
+}
+
+void testPriorityQueueConstruct_WhenArgumentIsInvalid_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(PriorityQueueConstruct(0, 4, CompareJobs, NULL));
+    TEST_ASSERT_NULL(PriorityQueueConstruct(sizeof(Job), 1, CompareJobs, NULL));
+    TEST_ASSERT_NULL(PriorityQueueConstruct(sizeof(Job), 65, CompareJobs, NULL));
+    TEST_ASSERT_NULL(PriorityQueueConstruct(sizeof(Job), 4, NULL, NULL));
+}
+
+//PriorityQueueConstructFromArray
+void testPriorityQueueConstructFromArray(void)
+{
+    Job jobs[100];
+    Job job;
+
+    for (int index = 0; index < 100; index++)
+    {
+        jobs[index].priority = (index * 37) % 100;
+        jobs[index].id = index;
+    }
+
+    PriorityQueue* newQueue = PriorityQueueConstructFromArray(sizeof(Job), 3, CompareJobs, NULL, jobs, 100);
+    TEST_ASSERT_EQUAL_UINT(100, PriorityQueueGetSize(newQueue));
+    TEST_ASSERT_EQUAL_INT(37, ((Job*)PriorityQueueGetData(newQueue, 1))->priority);
+
+    for (int priority = 0; priority < 100; priority++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, PriorityQueuePop(newQueue, &job));
+        TEST_ASSERT_EQUAL_INT(priority, job.priority);
+    }
+
+    PriorityQueueDestruct(&newQueue);
+}
+
+void testPriorityQueueConstructFromArray_WhenArrayIsNULL_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(PriorityQueueConstructFromArray(sizeof(Job), 4, CompareJobs, NULL, NULL, 3));
+}
+
+//PriorityQueueDestruct
+void testPriorityQueueDestruct_WhenQueueIsNULL_Return(void)
+{
+    PriorityQueue* newQueue = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueDestruct(&newQueue));
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueDestruct(NULL));
+}
+
+//PriorityQueuePush
+void testPriorityQueuePush(void)
+{
+    Job job = {5, 1};
+    PriorityQueueHandle handle;
+
+    TEST_ASSERT_EQUAL_INT(0, PriorityQueuePush(myQueue, &job, &handle));
+    TEST_ASSERT_EQUAL_UINT(1, PriorityQueueGetSize(myQueue));
+    TEST_ASSERT_EQUAL_INT(1, ((Job*)PriorityQueueGetData(myQueue, handle))->id);
+}
+
+void testPriorityQueuePush_WhenArgumentIsNULL_Return(void)
+{
+    Job job = {5, 1};
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueuePush(NULL, &job, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueuePush(myQueue, NULL, NULL));
+}
+
+//PriorityQueuePop
+void testPriorityQueuePop_ReturnsElementsInOrder(void)
+{
+    uint32_t state = 7;
+    int previous = -1;
+    Job job;
+
+    for (int index = 0; index < 5000; index++)
+    {
+        state = state * 1664525u + 1013904223u;
+        PushJob((int)(state >> 16), index);
+    }
+
+    for (int index = 0; index < 5000; index++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, PriorityQueuePop(myQueue, &job));
+        TEST_ASSERT_TRUE(job.priority >= previous);
+        previous = job.priority;
+    }
+
+    TEST_ASSERT_EQUAL_UINT(0, PriorityQueueGetSize(myQueue));
+}
+
+void testPriorityQueuePop_WhenQueueIsEmpty_Return(void)
+{
+    Job job;
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueuePop(myQueue, &job));
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueuePop(NULL, &job));
+}
+
+void testPriorityQueuePop_InvalidatesHandle(void)
+{
+    Job job = {5, 1};
+    PriorityQueueHandle handle;
+
+    PriorityQueuePush(myQueue, &job, &handle);
+    PriorityQueuePop(myQueue, NULL);
+
+    TEST_ASSERT_NULL(PriorityQueueGetData(myQueue, handle));
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueDecreaseKey(myQueue, handle, &job));
+}
+
+//PriorityQueuePeek
+void testPriorityQueuePeek(void)
+{
+    PushJob(30, 1);
+    PushJob(10, 2);
+    PushJob(20, 3);
+
+    TEST_ASSERT_EQUAL_INT(2, ((Job*)PriorityQueuePeek(myQueue))->id);
+    TEST_ASSERT_EQUAL_UINT(3, PriorityQueueGetSize(myQueue));
+}
+
+void testPriorityQueuePeek_WhenQueueIsEmpty_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(PriorityQueuePeek(myQueue));
+    TEST_ASSERT_NULL(PriorityQueuePeek(NULL));
+}
+
+//PriorityQueueDecreaseKey
+void testPriorityQueueDecreaseKey(void)
+{
+    PriorityQueueHandle handles[10];
+    Job job;
+
+    for (int index = 0; index < 10; index++)
+    {
+        job.priority = 100 + index;
+        job.id = index;
+        PriorityQueuePush(myQueue, &job, &handles[index]);
+    }
+
+    job.priority = 1;
+    job.id = 7;
+    TEST_ASSERT_EQUAL_INT(0, PriorityQueueDecreaseKey(myQueue, handles[7], &job));
+    TEST_ASSERT_EQUAL_INT(7, ((Job*)PriorityQueuePeek(myQueue))->id);
+    TEST_ASSERT_EQUAL_INT(1, ((Job*)PriorityQueueGetData(myQueue, handles[7]))->priority);
+    TEST_ASSERT_EQUAL_INT(105, ((Job*)PriorityQueueGetData(myQueue, handles[5]))->priority);
+}
+
+void testPriorityQueueDecreaseKey_WhenKeyIncreases_Return(void)
+{
+    Job job = {5, 1};
+    PriorityQueueHandle handle;
+
+    PriorityQueuePush(myQueue, &job, &handle);
+    job.priority = 6;
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueDecreaseKey(myQueue, handle, &job));
+    TEST_ASSERT_EQUAL_INT(5, ((Job*)PriorityQueuePeek(myQueue))->priority);
+}
+
+void testPriorityQueueDecreaseKey_WhenHandleIsUnknown_Return(void)
+{
+    Job job = {5, 1};
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueDecreaseKey(myQueue, 3, &job));
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueDecreaseKey(NULL, 0, &job));
+}
+
+//PriorityQueueClear
+void testPriorityQueueClear(void)
+{
+    PushJob(30, 1);
+    PushJob(10, 2);
+
+    TEST_ASSERT_EQUAL_INT(0, PriorityQueueClear(myQueue));
+    TEST_ASSERT_EQUAL_UINT(0, PriorityQueueGetSize(myQueue));
+    TEST_ASSERT_NULL(PriorityQueuePeek(myQueue));
+    TEST_ASSERT_EQUAL_INT(-1, PriorityQueueClear(NULL));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // PriorityQueueConstruct
+    MY_RUN_TEST(testPriorityQueueConstruct);
+    MY_RUN_TEST(testPriorityQueueConstruct_WhenArgumentIsInvalid_ReturnNULL);
+
+    //PriorityQueueConstructFromArray
+    MY_RUN_TEST(testPriorityQueueConstructFromArray);
+    MY_RUN_TEST(testPriorityQueueConstructFromArray_WhenArrayIsNULL_ReturnNULL);
+
+    //PriorityQueueDestruct
+    MY_RUN_TEST(testPriorityQueueDestruct_WhenQueueIsNULL_Return);
+
+    //PriorityQueuePush
+    MY_RUN_TEST(testPriorityQueuePush);
+    MY_RUN_TEST(testPriorityQueuePush_WhenArgumentIsNULL_Return);
+
+    //PriorityQueuePop
+    MY_RUN_TEST(testPriorityQueuePop_ReturnsElementsInOrder);
+    MY_RUN_TEST(testPriorityQueuePop_WhenQueueIsEmpty_Return);
+    MY_RUN_TEST(testPriorityQueuePop_InvalidatesHandle);
+
+    //PriorityQueuePeek
+    MY_RUN_TEST(testPriorityQueuePeek);
+    MY_RUN_TEST(testPriorityQueuePeek_WhenQueueIsEmpty_ReturnNULL);
+
+    //PriorityQueueDecreaseKey
+    MY_RUN_TEST(testPriorityQueueDecreaseKey);
+    MY_RUN_TEST(testPriorityQueueDecreaseKey_WhenKeyIncreases_Return);
+    MY_RUN_TEST(testPriorityQueueDecreaseKey_WhenHandleIsUnknown_Return);
+
+    //PriorityQueueClear
+    MY_RUN_TEST(testPriorityQueueClear);
+
+    return UnityEnd();
+}
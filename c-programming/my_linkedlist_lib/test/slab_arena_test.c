@@ -0,0 +1,164 @@
+#include <stdint.h>
+#include <string.h>
+#include "unity.h"
+#include "slab_arena.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static SlabArena* myArena = NULL;
+
+void setUp(void)
+{
+    myArena = SlabArenaConstruct(256);
+}
+
+void tearDown(void)
+{
+    SlabArenaDestruct(&myArena);
+}
+
+// SlabArenaConstruct
+void testSlabArenaConstruct(void)
+{
+    SlabArena* newArena = SlabArenaConstruct(1024);
+    TEST_ASSERT_NOT_NULL(newArena);
+    TEST_ASSERT_EQUAL_UINT(0, SlabArenaGetSlabCount(newArena));
+
+    TEST_ASSERT_EQUAL_INT(0, SlabArenaDestruct(&newArena));
+    TEST_ASSERT_NULL(newArena);
+}
+
+void testSlabArenaConstruct_WhenSlabSizeIsZero_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(SlabArenaConstruct(0));
+}
+
+//SlabArenaDestruct
+void testSlabArenaDestruct_WhenArenaIsNULL_Return(void)
+{
+    SlabArena* newArena = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, SlabArenaDestruct(&newArena));
+    TEST_ASSERT_EQUAL_INT(-1, SlabArenaDestruct(NULL));
+}
+
+//SlabArenaAllocate
+void testSlabArenaAllocate(void)
+{
+    char* first = SlabArenaAllocate(myArena, 5);
+    char* second = SlabArenaAllocate(myArena, 11);
+
+    memcpy(first, "hello", 5);
+    memcpy(second, "slab arenas", 11);
+
+    TEST_ASSERT_EQUAL_UINT(5, SlabArenaGetSize(first));
+    TEST_ASSERT_EQUAL_UINT(11, SlabArenaGetSize(second));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(first, "hello", 5));
+    TEST_ASSERT_EQUAL_UINT(1, SlabArenaGetSlabCount(myArena));
+}
+
+void testSlabArenaAllocate_ReturnsAlignedBlocks(void)
+{
+    for (size_t size = 0; size < 40; size++)
+    {
+        void* block = SlabArenaAllocate(myArena, size);
+        TEST_ASSERT_EQUAL_UINT(0, (uintptr_t)block % 16);
+    }
+}
+
+void testSlabArenaAllocate_WhenSlabIsFull_AddSlab(void)
+{
+    for (int index = 0; index < 16; index++)
+    {
+        SlabArenaAllocate(myArena, 40);
+    }
+
+    TEST_ASSERT_TRUE(SlabArenaGetSlabCount(myArena) > 1);
+}
+
+void testSlabArenaAllocate_WhenBlockIsLarge_UseOwnSlab(void)
+{
+    char* small = SlabArenaAllocate(myArena, 8);
+    char* large = SlabArenaAllocate(myArena, 1000);
+    char* next = SlabArenaAllocate(myArena, 8);
+
+    memset(large, 'x', 1000);
+    TEST_ASSERT_EQUAL_UINT(1000, SlabArenaGetSize(large));
+    TEST_ASSERT_EQUAL_UINT(2, SlabArenaGetSlabCount(myArena));
+    TEST_ASSERT_TRUE(next > small && next - small < 256);
+
+    SlabArenaRelease(large);
+    TEST_ASSERT_EQUAL_UINT(1, SlabArenaGetSlabCount(myArena));
+}
+
+void testSlabArenaAllocate_WhenArenaIsNULL_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(SlabArenaAllocate(NULL, 8));
+}
+
+//SlabArenaRelease
+void testSlabArenaRelease_WhenSlabIsEmpty_FreeSlab(void)
+{
+    void* blocks[16];
+
+    for (int index = 0; index < 16; index++)
+    {
+        blocks[index] = SlabArenaAllocate(myArena, 40);
+    }
+
+    size_t slabCount = SlabArenaGetSlabCount(myArena);
+
+    for (int index = 0; index < 4; index++)
+    {
+        SlabArenaRelease(blocks[index]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT(slabCount - 1, SlabArenaGetSlabCount(myArena));
+
+    for (int index = 4; index < 16; index++)
+    {
+        SlabArenaRelease(blocks[index]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT(1, SlabArenaGetSlabCount(myArena));
+}
+
+void testSlabArenaRelease_WhenCurrentSlabIsEmpty_ReuseIt(void)
+{
+    void* first = SlabArenaAllocate(myArena, 32);
+
+    SlabArenaRelease(first);
+    TEST_ASSERT_TRUE(SlabArenaAllocate(myArena, 32) == first);
+    TEST_ASSERT_EQUAL_UINT(1, SlabArenaGetSlabCount(myArena));
+}
+
+void testSlabArenaRelease_WhenBlockIsNULL_Return(void)
+{
+    SlabArenaRelease(NULL);
+    TEST_ASSERT_EQUAL_UINT(0, SlabArenaGetSize(NULL));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // SlabArenaConstruct
+    MY_RUN_TEST(testSlabArenaConstruct);
+    MY_RUN_TEST(testSlabArenaConstruct_WhenSlabSizeIsZero_ReturnNULL);
+
+    //SlabArenaDestruct
+    MY_RUN_TEST(testSlabArenaDestruct_WhenArenaIsNULL_Return);
+
+    //SlabArenaAllocate
+    MY_RUN_TEST(testSlabArenaAllocate);
+    MY_RUN_TEST(testSlabArenaAllocate_ReturnsAlignedBlocks);
+    MY_RUN_TEST(testSlabArenaAllocate_WhenSlabIsFull_AddSlab);
+    MY_RUN_TEST(testSlabArenaAllocate_WhenBlockIsLarge_UseOwnSlab);
+    MY_RUN_TEST(testSlabArenaAllocate_WhenArenaIsNULL_ReturnNULL);
+
+    //SlabArenaRelease
+    MY_RUN_TEST(testSlabArenaRelease_WhenSlabIsEmpty_FreeSlab);
+    MY_RUN_TEST(testSlabArenaRelease_WhenCurrentSlabIsEmpty_ReuseIt);
+    MY_RUN_TEST(testSlabArenaRelease_WhenBlockIsNULL_Return);
+
+    return UnityEnd();
+}
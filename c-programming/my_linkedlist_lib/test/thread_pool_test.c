@@ -0,0 +1,260 @@
+#include <string.h>
+#include "unity.h"
+#include "thread_pool.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+static ThreadPool* myPool = NULL;
+
+void setUp(void)
+{
+    myPool = ThreadPoolConstruct(4);
+}
+
+void tearDown(void)
+{
+    ThreadPoolDestruct(&myPool);
+}
+
+static void Increment(void* argument)
+{
+    __atomic_add_fetch((int*)argument, 1, __ATOMIC_RELAXED);
+}
+
+typedef struct nested_work NestedWork;
+struct nested_work
+{
+    ThreadPool* pool;
+    int children;
+    int counter;
+};
+
+static void SubmitChildren(void* argument)
+{
+    NestedWork* work = argument;
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+
+    for (int index = 0; index < work->children; index++)
+    {
+        ThreadPoolSubmit(work->pool, &group, Increment, &work->counter);
+    }
+
+    ThreadPoolWait(work->pool, &group);
+}
+
+static void MarkRange(size_t begin, size_t end, void* context)
+{
+    unsigned char* marks = context;
+
+    for (size_t index = begin; index < end; index++)
+    {
+        marks[index]++;
+    }
+}
+
+static void CountCalls(size_t begin, size_t end, void* context)
+{
+    (void)begin;
+    (void)end;
+    Increment(context);
+}
+
+// ThreadPoolConstruct
+void testThreadPoolConstruct(void)
+{
+    ThreadPool* newPool = ThreadPoolConstruct(2);
+    TEST_ASSERT_NOT_NULL(newPool);
+    TEST_ASSERT_EQUAL_INT(2, ThreadPoolGetThreadCount(newPool));
+
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolDestruct(&newPool));
+    TEST_ASSERT_NULL(newPool);
+}
+
+void testThreadPoolConstruct_WhenThreadCountIsZero_UseOnlineCpus(void)
+{
+    ThreadPool* newPool = ThreadPoolConstruct(0);
+    TEST_ASSERT_NOT_NULL(newPool);
+    TEST_ASSERT_TRUE(ThreadPoolGetThreadCount(newPool) >= 1);
+
+    ThreadPoolDestruct(&newPool);
+}
+
+//ThreadPoolDestruct
+void testThreadPoolDestruct_WhenPoolIsNULL_Return(void)
+{
+    ThreadPool* newPool = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolDestruct(&newPool));
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolDestruct(NULL));
+}
+
+void testThreadPoolDestruct_RunsDetachedTasks(void)
+{
+    int counter = 0;
+    ThreadPool* newPool = ThreadPoolConstruct(2);
+
+    for (int index = 0; index < 100; index++)
+    {
+        ThreadPoolSubmit(newPool, NULL, Increment, &counter);
+    }
+
+    ThreadPoolDestruct(&newPool);
+    TEST_ASSERT_EQUAL_INT(100, counter);
+}
+
+//ThreadPoolGetDefault
+void testThreadPoolGetDefault_ReturnsSamePool(void)
+{
+    ThreadPool* pool = ThreadPoolGetDefault();
+    TEST_ASSERT_NOT_NULL(pool);
+    TEST_ASSERT_TRUE(pool == ThreadPoolGetDefault());
+}
+
+//ThreadPoolSubmit
+void testThreadPoolSubmit(void)
+{
+    int counter = 0;
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+
+    for (int index = 0; index < 1000; index++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, ThreadPoolSubmit(myPool, &group, Increment, &counter));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolWait(myPool, &group));
+    TEST_ASSERT_EQUAL_INT(1000, counter);
+}
+
+void testThreadPoolSubmit_WhenArgumentIsNULL_Return(void)
+{
+    int counter = 0;
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolSubmit(NULL, NULL, Increment, &counter));
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolSubmit(myPool, NULL, NULL, &counter));
+}
+
+void testThreadPoolSubmit_FromTask_GrowsWorkerDeque(void)
+{
+    NestedWork work = {myPool, 5000, 0};
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+
+    ThreadPoolSubmit(myPool, &group, SubmitChildren, &work);
+    ThreadPoolWait(myPool, &group);
+
+    TEST_ASSERT_EQUAL_INT(5000, work.counter);
+}
+
+//ThreadPoolWait
+void testThreadPoolWait_WhenArgumentIsNULL_Return(void)
+{
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolWait(NULL, &group));
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolWait(myPool, NULL));
+}
+
+void testThreadPoolWait_WhenGroupIsEmpty_ReturnImmediately(void)
+{
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolWait(myPool, &group));
+}
+
+void testThreadPoolWait_WithSingleWorker_NestedWaitsRunQueuedTasks(void)
+{
+    int counter = 0;
+    NestedWork work = {NULL, 10, 0};
+    ThreadPool* newPool = ThreadPoolConstruct(1);
+    ThreadPoolGroup group;
+    ThreadPoolGroupInit(&group);
+
+    work.pool = newPool;
+
+    for (int index = 0; index < 10; index++)
+    {
+        ThreadPoolSubmit(newPool, &group, SubmitChildren, &work);
+        ThreadPoolSubmit(newPool, &group, Increment, &counter);
+    }
+
+    ThreadPoolWait(newPool, &group);
+    TEST_ASSERT_EQUAL_INT(10, counter);
+    TEST_ASSERT_EQUAL_INT(100, work.counter);
+
+    ThreadPoolDestruct(&newPool);
+}
+
+//ThreadPoolParallelFor
+void testThreadPoolParallelFor_VisitsEveryIndexOnce(void)
+{
+    static unsigned char marks[100000];
+    memset(marks, 0, sizeof(marks));
+
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolParallelFor(myPool, 0, sizeof(marks), 64, MarkRange, marks));
+
+    for (size_t index = 0; index < sizeof(marks); index++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(1, marks[index]);
+    }
+}
+
+void testThreadPoolParallelFor_RespectsGrain(void)
+{
+    int calls = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolParallelFor(myPool, 0, 1024, 16, CountCalls, &calls));
+    TEST_ASSERT_EQUAL_INT(64, calls);
+
+    calls = 0;
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolParallelFor(myPool, 10, 20, 0, CountCalls, &calls));
+    TEST_ASSERT_EQUAL_INT(10, calls);
+}
+
+void testThreadPoolParallelFor_WhenRangeIsEmpty_CallNothing(void)
+{
+    int calls = 0;
+    TEST_ASSERT_EQUAL_INT(0, ThreadPoolParallelFor(myPool, 5, 5, 1, CountCalls, &calls));
+    TEST_ASSERT_EQUAL_INT(0, calls);
+}
+
+void testThreadPoolParallelFor_WhenArgumentIsInvalid_Return(void)
+{
+    int calls = 0;
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolParallelFor(NULL, 0, 10, 1, CountCalls, &calls));
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolParallelFor(myPool, 0, 10, 1, NULL, &calls));
+    TEST_ASSERT_EQUAL_INT(-1, ThreadPoolParallelFor(myPool, 10, 0, 1, CountCalls, &calls));
+}
+
+int main()
+{
+    UnityBegin();
+
+    // ThreadPoolConstruct
+    MY_RUN_TEST(testThreadPoolConstruct);
+    MY_RUN_TEST(testThreadPoolConstruct_WhenThreadCountIsZero_UseOnlineCpus);
+
+    //ThreadPoolDestruct
+    MY_RUN_TEST(testThreadPoolDestruct_WhenPoolIsNULL_Return);
+    MY_RUN_TEST(testThreadPoolDestruct_RunsDetachedTasks);
+
+    //ThreadPoolGetDefault
+    MY_RUN_TEST(testThreadPoolGetDefault_ReturnsSamePool);
+
+    //ThreadPoolSubmit
+    MY_RUN_TEST(testThreadPoolSubmit);
+    MY_RUN_TEST(testThreadPoolSubmit_WhenArgumentIsNULL_Return);
+    MY_RUN_TEST(testThreadPoolSubmit_FromTask_GrowsWorkerDeque);
+
+    //ThreadPoolWait
+    MY_RUN_TEST(testThreadPoolWait_WhenArgumentIsNULL_Return);
+    MY_RUN_TEST(testThreadPoolWait_WhenGroupIsEmpty_ReturnImmediately);
+    MY_RUN_TEST(testThreadPoolWait_WithSingleWorker_NestedWaitsRunQueuedTasks);
+
+    //ThreadPoolParallelFor
+    MY_RUN_TEST(testThreadPoolParallelFor_VisitsEveryIndexOnce);
+    MY_RUN_TEST(testThreadPoolParallelFor_RespectsGrain);
+    MY_RUN_TEST(testThreadPoolParallelFor_WhenRangeIsEmpty_CallNothing);
+    MY_RUN_TEST(testThreadPoolParallelFor_WhenArgumentIsInvalid_Return);
+
+    return UnityEnd();
+}
@@ -0,0 +1,210 @@
+#include "unity.h"
+#include "typed_list.h"
+
+#define MY_RUN_TEST(func) RUN_TEST(func, 0)
+
+typedef struct element Element;
+struct element
+{
+    int address;
+    char tag;
+};
+
+#define ELEMENT_EQUALS(a, b) ((a)->address == (b)->address)
+
+LIST_DEFINE(IntList, int)
+LIST_DEFINE_WITH_EQUALS(ElementList, Element, ELEMENT_EQUALS)
+
+static IntList* myList = NULL;
+
+void setUp(void)
+{
+    myList = IntList_Construct();
+}
+
+void tearDown(void)
+{
+    IntList_Destruct(&myList);
+}
+
+//IntList_Construct
+void testIntListConstruct(void)
+{
+    IntList* newList = IntList_Construct();
+    TEST_ASSERT_NOT_NULL(newList);
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_Destruct(&newList));
+    TEST_ASSERT_NULL(newList);
+}
+
+void testIntListDestruct_WhenListIsNULL_Return(void)
+{
+    IntList* newList = NULL;
+    TEST_ASSERT_EQUAL_INT(-1, IntList_Destruct(&newList));
+}
+
+//IntList_AddHead / IntList_AddTail
+void testIntListAddTail(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddTail(myList, 20));
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddTail(myList, 240));
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddHead(myList, 60));
+
+    TEST_ASSERT_EQUAL_INT(60, *IntList_GetHeadData(myList));
+    TEST_ASSERT_EQUAL_INT(20, *IntList_GetNextData(myList));
+    TEST_ASSERT_EQUAL_INT(240, *IntList_GetNextData(myList));
+    TEST_ASSERT_NULL(IntList_GetNextData(myList));
+}
+
+void testIntListAddTail_WhenListIsNULL_Return(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, IntList_AddTail(NULL, 20));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_AddHead(NULL, 20));
+}
+
+//IntList_GetTailData / IntList_GetPreviousData
+void testIntListGetPreviousData(void)
+{
+    IntList_AddTail(myList, 1);
+    IntList_AddTail(myList, 2);
+    IntList_AddTail(myList, 3);
+
+    TEST_ASSERT_EQUAL_INT(3, *IntList_GetTailData(myList));
+    TEST_ASSERT_EQUAL_INT(2, *IntList_GetPreviousData(myList));
+    TEST_ASSERT_EQUAL_INT(1, *IntList_GetPreviousData(myList));
+    TEST_ASSERT_NULL(IntList_GetPreviousData(myList));
+}
+
+void testIntListGetData_WhenListIsEmpty_ReturnNULL(void)
+{
+    TEST_ASSERT_NULL(IntList_GetHeadData(myList));
+    TEST_ASSERT_NULL(IntList_GetTailData(myList));
+    TEST_ASSERT_NULL(IntList_GetNextData(myList));
+    TEST_ASSERT_NULL(IntList_GetPreviousData(myList));
+}
+
+//IntList_AddBefore / IntList_AddAfter
+void testIntListAddBefore(void)
+{
+    IntList_AddTail(myList, 20);
+    IntList_AddTail(myList, 240);
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddBefore(myList, 60, 240));
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddBefore(myList, 10, 20));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_AddBefore(myList, 10, 999));
+
+    TEST_ASSERT_EQUAL_INT(10, *IntList_GetHeadData(myList));
+    TEST_ASSERT_EQUAL_INT(20, *IntList_GetNextData(myList));
+    TEST_ASSERT_EQUAL_INT(60, *IntList_GetNextData(myList));
+    TEST_ASSERT_EQUAL_INT(240, *IntList_GetNextData(myList));
+    TEST_ASSERT_EQUAL_INT(60, *IntList_GetPreviousData(myList));
+}
+
+void testIntListAddAfter(void)
+{
+    IntList_AddTail(myList, 20);
+    IntList_AddTail(myList, 240);
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddAfter(myList, 60, 20));
+    TEST_ASSERT_EQUAL_INT(0, IntList_AddAfter(myList, 300, 240));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_AddAfter(myList, 10, 999));
+
+    TEST_ASSERT_EQUAL_INT(300, *IntList_GetTailData(myList));
+    TEST_ASSERT_EQUAL_INT(240, *IntList_GetPreviousData(myList));
+    TEST_ASSERT_EQUAL_INT(60, *IntList_GetPreviousData(myList));
+    TEST_ASSERT_EQUAL_INT(20, *IntList_GetPreviousData(myList));
+}
+
+//IntList_Remove*
+void testIntListRemove(void)
+{
+    IntList_AddTail(myList, 20);
+    IntList_AddTail(myList, 240);
+    IntList_AddTail(myList, 60);
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_Remove(myList, 240));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_Remove(myList, 240));
+
+    TEST_ASSERT_EQUAL_INT(20, *IntList_GetHeadData(myList));
+    TEST_ASSERT_EQUAL_INT(60, *IntList_GetNextData(myList));
+    TEST_ASSERT_NULL(IntList_GetNextData(myList));
+}
+
+void testIntListRemove_WhenLastAccessedIsDeleted_ReturnNULL(void)
+{
+    IntList_AddTail(myList, 20);
+    IntList_AddTail(myList, 240);
+
+    IntList_GetTailData(myList);
+    IntList_RemoveTail(myList);
+
+    TEST_ASSERT_NULL(IntList_GetPreviousData(myList));
+}
+
+void testIntListRemoveHeadAndTail(void)
+{
+    IntList_AddTail(myList, 20);
+    IntList_AddTail(myList, 240);
+    IntList_AddTail(myList, 60);
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_RemoveHead(myList));
+    TEST_ASSERT_EQUAL_INT(0, IntList_RemoveTail(myList));
+    TEST_ASSERT_EQUAL_INT(240, *IntList_GetHeadData(myList));
+    TEST_ASSERT_EQUAL_INT(240, *IntList_GetTailData(myList));
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_RemoveTail(myList));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_RemoveTail(myList));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_RemoveHead(myList));
+}
+
+//IntList_Clear
+void testIntListClear(void)
+{
+    IntList_AddTail(myList, 20);
+    IntList_AddTail(myList, 240);
+
+    TEST_ASSERT_EQUAL_INT(0, IntList_Clear(myList));
+    TEST_ASSERT_NULL(IntList_GetHeadData(myList));
+    TEST_ASSERT_EQUAL_INT(-1, IntList_Clear(NULL));
+}
+
+//ElementList
+void testElementList_UsesCustomEquals(void)
+{
+    ElementList* elementList = ElementList_Construct();
+    Element a = {20, 'a'};
+    Element b = {240, 'b'};
+    Element key = {240, 'z'};
+
+    ElementList_AddTail(elementList, a);
+    ElementList_AddTail(elementList, b);
+
+    TEST_ASSERT_EQUAL_INT(0, ElementList_Remove(elementList, key));
+
+    Element* elementPtr = ElementList_GetTailData(elementList);
+    TEST_ASSERT_EQUAL_INT(20, elementPtr->address);
+    TEST_ASSERT_EQUAL_INT('a', elementPtr->tag);
+
+    ElementList_Destruct(&elementList);
+}
+
+int main()
+{
+    UnityBegin();
+
+    MY_RUN_TEST(testIntListConstruct);
+    MY_RUN_TEST(testIntListDestruct_WhenListIsNULL_Return);
+    MY_RUN_TEST(testIntListAddTail);
+    MY_RUN_TEST(testIntListAddTail_WhenListIsNULL_Return);
+    MY_RUN_TEST(testIntListGetPreviousData);
+    MY_RUN_TEST(testIntListGetData_WhenListIsEmpty_ReturnNULL);
+    MY_RUN_TEST(testIntListAddBefore);
+    MY_RUN_TEST(testIntListAddAfter);
+    MY_RUN_TEST(testIntListRemove);
+    MY_RUN_TEST(testIntListRemove_WhenLastAccessedIsDeleted_ReturnNULL);
+    MY_RUN_TEST(testIntListRemoveHeadAndTail);
+    MY_RUN_TEST(testIntListClear);
+    MY_RUN_TEST(testElementList_UsesCustomEquals);
+
+    return UnityEnd();
+}